@@ -1,14 +1,22 @@
 
 #include <errno.h>
+#include <fcntl.h>
 #include <getopt.h>
 #include <limits.h>
+#include <poll.h>
 #include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
 #include <stdarg.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
 
 #ifdef USE_READLINE
 #include <readline/history.h>
@@ -17,6 +25,17 @@
 
 #include "zforth.h"
 
+/* In batch mode each worker thread writes the output of its job, including
+ * error messages, to a buffer which is printed when the job is done, see
+ * run_jobs() */
+
+static _Thread_local FILE *job_out;
+static _Thread_local int job_errors;
+static _Thread_local bool job_bye;
+
+#define OUT (job_out ? job_out : stdout)
+#define ERR (job_out ? job_out : stderr)
+
 /*
  * Evaluate buffer with code, check return value and report errors
  */
@@ -24,6 +43,7 @@
 zf_result do_eval(const char *src, int line, const char *buf)
 {
     const char *msg = NULL;
+    char thrown[48];
 
     zf_result rv = zf_eval(buf);
 
@@ -64,16 +84,34 @@ zf_result do_eval(const char *src, int line, const char *buf)
     case ZF_ABORT_DIVISION_BY_ZERO:
         msg = "division by zero";
         break;
+    case ZF_ABORT_OUTSIDE_PAD:
+        msg = "outside PAD memory";
+        break;
+    case ZF_ABORT_BLOCK_IO:
+        msg = "block I/O error";
+        break;
+    case ZF_ABORT_INTERRUPT:
+        msg = "interrupted";
+        break;
+    case ZF_RUNNING:
+        msg = "evaluation not finished";
+        break;
+    case ZF_ABORT_THROW:
+        snprintf(thrown, sizeof(thrown), "uncaught throw " ZF_CELL_FMT, zf_throw_code());
+        msg = thrown;
+        break;
     default:
-        msg = "unknown error";
+        snprintf(thrown, sizeof(thrown), "unknown error %d", rv);
+        msg = thrown;
     }
 
-    if (msg)
+    if (msg && !job_bye)
     {
-        fprintf(stderr, "\033[31m");
+        job_errors++;
+        fprintf(ERR, "\033[31m");
         if (src)
-            fprintf(stderr, "%s:%d: ", src, line);
-        fprintf(stderr, "%s\033[0m\n", msg);
+            fprintf(ERR, "%s:%d: ", src, line);
+        fprintf(ERR, "%s\033[0m\n", msg);
     }
 
     return rv;
@@ -91,7 +129,7 @@ void include(const char *fname)
     int line = 1;
     if (f)
     {
-        while (fgets(buf, sizeof(buf), f))
+        while (!job_bye && fgets(buf, sizeof(buf), f))
         {
             do_eval(fname, line++, buf);
         }
@@ -99,76 +137,811 @@ void include(const char *fname)
     }
     else
     {
-        fprintf(stderr, "error opening file '%s': %s\n", fname, strerror(errno));
+        job_errors++;
+        fprintf(ERR, "error opening file '%s': %s\n", fname, strerror(errno));
     }
 }
 
+/*
+ * Image stream callbacks
+ */
+
+static size_t file_write(void *arg, const void *buf, size_t len)
+{
+    return fwrite(buf, 1, len, (FILE *)arg);
+}
+
+static size_t file_read(void *arg, void *buf, size_t len)
+{
+    return fread(buf, 1, len, (FILE *)arg);
+}
+
 /*
  * Save dictionary
  */
 
-static void save(const char *fname)
+static int save(const char *fname, int flags)
 {
-    size_t len;
-    void *p = zf_dump(&len);
     FILE *f = fopen(fname, "wb");
     if (f)
     {
-        fwrite(p, 1, len, f);
-        fclose(f);
+        size_t len = zf_image_save(file_write, f, flags);
+        if (fclose(f) == 0 && len > 0)
+            return 0;
+    }
+    fprintf(ERR, "error writing image '%s': %s\n", fname, strerror(errno));
+    return -1;
+}
+
+/*
+ * Export a standalone image holding only what the entry word needs
+ */
+
+static int export(const char *entry, const char *fname, int flags)
+{
+    FILE *f = fopen(fname, "wb");
+    if (f)
+    {
+        size_t len = zf_export(entry, flags, file_write, f);
+        if (fclose(f) == 0 && len > 0)
+            return 0;
     }
+    fprintf(ERR, "error exporting '%s' to '%s'\n", entry, fname);
+    return -1;
 }
 
 /*
  * Load dictionary
  */
 
-static void load(const char *fname)
+static int load(const char *fname)
 {
-    size_t len;
-    void *p = zf_dump(&len);
     FILE *f = fopen(fname, "rb");
     if (f)
     {
-        fread(p, 1, len, f);
+        zf_result rv = zf_image_load(file_read, f);
         fclose(f);
+        if (rv == ZF_OK)
+            return 0;
+        fprintf(ERR, "error loading image '%s': invalid image\n", fname);
     }
     else
     {
-        perror("read");
+        fprintf(ERR, "error opening image '%s': %s\n", fname, strerror(errno));
+    }
+    return -1;
+}
+
+/*
+ * Map dictionary image: the file is mapped copy-on-write, followed by
+ * anonymous memory for the rest of the interpreter memory, so processes
+ * running the same image share the pages they do not modify
+ */
+
+static int map(const char *fname)
+{
+    struct stat st;
+    size_t len;
+    int fd = open(fname, O_RDONLY);
+
+    if (fd < 0 || fstat(fd, &st) < 0)
+    {
+        perror(fname);
+        if (fd >= 0)
+            close(fd);
+        return -1;
+    }
+
+    zf_dump(&len);
+    len += st.st_size;
+    uint8_t *p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (p == MAP_FAILED ||
+        mmap(p, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        perror("mmap");
+        close(fd);
+        return -1;
+    }
+    close(fd);
+
+    if (zf_image_map(p, st.st_size) != ZF_OK)
+    {
+        fprintf(stderr, "error mapping image '%s': invalid image\n", fname);
+        munmap(p, len);
+        return -1;
+    }
+    return 0;
+}
+
+/*
+ * Report startup time and memory use
+ */
+
+static void stats(const struct timespec *start)
+{
+    struct timespec now;
+    long size = 0, resident = 0, shared = 0;
+    long page = sysconf(_SC_PAGESIZE) / 1024;
+    FILE *f = fopen("/proc/self/statm", "r");
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (f)
+    {
+        fscanf(f, "%ld %ld %ld", &size, &resident, &shared);
+        fclose(f);
     }
+    fprintf(stderr, "startup %.3f ms, rss %ld kB (shared %ld kB)\n",
+            (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6,
+            resident * page, shared * page);
+}
+
+/*
+ * Channels: bounded single producer, single consumer ring buffers shared by
+ * all interpreters of the process. A message is a 4 byte length followed by
+ * the bytes, copied straight from the memory of the sender into the ring and
+ * from the ring into the memory of the receiver. The sender only moves
+ * 'head' and the receiver only 'tail', so no lock is needed. Waiting is a
+ * sched_yield() loop.
+ *
+ * The first interpreter which sends on a channel owns its sending end, and
+ * the first which receives its receiving end; others using an end abort.
+ * When an interpreter is freed its ends are closed, see channel_release(),
+ * and a channel is freed once both ends are closed, or are unused and the
+ * interpreter which created it is gone. Opening, claiming an end and
+ * releasing take channel_lock, sending and receiving do not.
+ */
+
+#define CHANNELS 256
+#define CHANNEL_CLOSED ((zf_ctx *)1)
+
+typedef struct
+{
+    _Atomic bool open;
+    uint8_t *buf;
+    size_t size; /* power of two */
+    _Atomic size_t head;
+    _Atomic size_t tail;
+    zf_ctx *opener; /* NULL once freed */
+    _Atomic(zf_ctx *) sender;
+    _Atomic(zf_ctx *) receiver;
+} channel_t;
+
+static channel_t channels[CHANNELS];
+static pthread_mutex_t channel_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Channel 'n', with its sending or receiving end owned by the calling
+ * interpreter */
+
+static channel_t *channel_get(zf_cell n, bool send)
+{
+    zf_ctx *self = zf_ctx_current(), *none = NULL;
+    channel_t *ch;
+
+    if (n < 0 || n >= CHANNELS)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    ch = &channels[(int)n];
+    _Atomic(zf_ctx *) *end = send ? &ch->sender : &ch->receiver;
+    if (atomic_load_explicit(end, memory_order_acquire) == self)
+        return ch;
+
+    pthread_mutex_lock(&channel_lock);
+    bool ok = atomic_load(&ch->open) && atomic_compare_exchange_strong(end, &none, self);
+    pthread_mutex_unlock(&channel_lock);
+    if (!ok)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    return ch;
+}
+
+static void channel_open(zf_cell n, size_t size)
+{
+    channel_t *ch;
+    size_t s = 64;
+
+    if (n < 0 || n >= CHANNELS)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    while (s < size)
+        s *= 2;
+    ch = &channels[(int)n];
+
+    pthread_mutex_lock(&channel_lock);
+    if (!atomic_load(&ch->open))
+    {
+        ch->buf = malloc(s);
+        if (ch->buf == NULL)
+        {
+            pthread_mutex_unlock(&channel_lock);
+            zf_abort(ZF_ABORT_OUTSIDE_MEM);
+        }
+        ch->size = s;
+        atomic_store(&ch->head, 0);
+        atomic_store(&ch->tail, 0);
+        ch->opener = zf_ctx_current();
+        atomic_store(&ch->sender, NULL);
+        atomic_store(&ch->receiver, NULL);
+        atomic_store(&ch->open, true);
+    }
+    pthread_mutex_unlock(&channel_lock);
+}
+
+/* An end is done when its owner is gone, or when nobody took it and the
+ * creator of the channel is gone */
+
+static bool channel_done(channel_t *ch, _Atomic(zf_ctx *) *end)
+{
+    zf_ctx *owner = atomic_load(end);
+    return owner == CHANNEL_CLOSED || (owner == NULL && ch->opener == NULL);
+}
+
+/* Close the ends owned by interpreter 'c', which is being freed, and free the
+ * channels which are done */
+
+static void channel_release(zf_ctx *c)
+{
+    pthread_mutex_lock(&channel_lock);
+    for (int n = 0; n < CHANNELS; n++)
+    {
+        channel_t *ch = &channels[n];
+        if (!atomic_load(&ch->open))
+            continue;
+        if (atomic_load(&ch->sender) == c)
+            atomic_store(&ch->sender, CHANNEL_CLOSED);
+        if (atomic_load(&ch->receiver) == c)
+            atomic_store(&ch->receiver, CHANNEL_CLOSED);
+        if (ch->opener == c)
+            ch->opener = NULL;
+        if (channel_done(ch, &ch->sender) && channel_done(ch, &ch->receiver))
+        {
+            atomic_store(&ch->open, false);
+            free(ch->buf);
+            ch->buf = NULL;
+        }
+    }
+    pthread_mutex_unlock(&channel_lock);
+}
+
+static void interp_release(zf_ctx *owner);
+
+static void interp_free(zf_ctx *c)
+{
+    interp_release(c);
+    channel_release(c);
+    zf_ctx_free(c);
+}
+
+/* Address of 'len' bytes of interpreter memory at 'addr' */
+
+static uint8_t *channel_mem(zf_cell addr, size_t len)
+{
+    size_t size;
+    uint8_t *mem = zf_dump(&size);
+    if (addr < 0 || len > size || addr > size - len)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    return mem + (size_t)addr;
+}
+
+static void ring_put(channel_t *ch, size_t at, const void *src, size_t len)
+{
+    size_t i = at & (ch->size - 1), n = ch->size - i < len ? ch->size - i : len;
+    memcpy(ch->buf + i, src, n);
+    memcpy(ch->buf, (const uint8_t *)src + n, len - n);
+}
+
+static void ring_get(channel_t *ch, size_t at, void *dst, size_t len)
+{
+    size_t i = at & (ch->size - 1), n = ch->size - i < len ? ch->size - i : len;
+    memcpy(dst, ch->buf + i, n);
+    memcpy((uint8_t *)dst + n, ch->buf, len - n);
+}
+
+static bool channel_send(channel_t *ch, const void *src, uint32_t len, bool wait)
+{
+    size_t head = atomic_load_explicit(&ch->head, memory_order_relaxed);
+
+    if (sizeof(len) + len > ch->size)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    while (ch->size - (head - atomic_load_explicit(&ch->tail, memory_order_acquire)) < sizeof(len) + len)
+    {
+        if (!wait)
+            return false;
+        sched_yield();
+    }
+    ring_put(ch, head, &len, sizeof(len));
+    ring_put(ch, head + sizeof(len), src, len);
+    atomic_store_explicit(&ch->head, head + sizeof(len) + len, memory_order_release);
+    return true;
+}
+
+/* Receive a message into 'dst', of at most 'max' bytes; the rest of a longer
+ * message is dropped. Returns the length of the message, or -1 when the
+ * channel is empty and 'wait' is false */
+
+static long channel_receive(channel_t *ch, void *dst, size_t max, bool wait)
+{
+    size_t tail = atomic_load_explicit(&ch->tail, memory_order_relaxed);
+    uint32_t len;
+
+    while (atomic_load_explicit(&ch->head, memory_order_acquire) == tail)
+    {
+        if (!wait)
+            return -1;
+        sched_yield();
+    }
+    ring_get(ch, tail, &len, sizeof(len));
+    ring_get(ch, tail + sizeof(len), dst, len < max ? len : max);
+    atomic_store_explicit(&ch->tail, tail + sizeof(len) + len, memory_order_release);
+    return len;
+}
+
+static void channel_sys(int id)
+{
+    switch (id)
+    {
+    case 160: // channel ( n size -- n )
+    {
+        size_t size = zf_pop();
+        zf_cell n = zf_pop();
+        channel_open(n, size);
+        zf_push(n);
+        break;
+    }
+
+    case 161: // send ( v ch -- )
+    case 162: // send? ( v ch -- flag )
+    {
+        channel_t *ch = channel_get(zf_pop(), true);
+        zf_cell v = zf_pop();
+        bool sent = channel_send(ch, &v, sizeof(v), id == 161);
+        if (id == 162)
+            zf_push(sent);
+        break;
+    }
+
+    case 163: // receive ( ch -- v )
+    case 164: // receive? ( ch -- v true | false )
+    {
+        channel_t *ch = channel_get(zf_pop(), false);
+        zf_cell v;
+        long len = channel_receive(ch, &v, sizeof(v), id == 163);
+        if (len >= 0 && len != sizeof(v))
+            zf_abort(ZF_ABORT_INVALID_SIZE);
+        if (len >= 0)
+            zf_push(v);
+        if (id == 164)
+            zf_push(len >= 0);
+        break;
+    }
+
+    case 165: // send-bytes ( addr len ch -- )
+    case 166: // send-bytes? ( addr len ch -- flag )
+    {
+        channel_t *ch = channel_get(zf_pop(), true);
+        size_t len = zf_pop();
+        uint8_t *src = channel_mem(zf_pop(), len);
+        bool sent = channel_send(ch, src, len, id == 165);
+        if (id == 166)
+            zf_push(sent);
+        break;
+    }
+
+    case 167: // receive-bytes ( addr len ch -- n )
+    case 168: // receive-bytes? ( addr len ch -- n true | false )
+    {
+        channel_t *ch = channel_get(zf_pop(), false);
+        size_t max = zf_pop();
+        uint8_t *dst = channel_mem(zf_pop(), max);
+        long len = channel_receive(ch, dst, max, id == 167);
+        if (len >= 0)
+            zf_push(len);
+        if (id == 168)
+            zf_push(len >= 0);
+        break;
+    }
+    }
+}
+
+/*
+ * pmap and preduce: the array is split in one chunk per CPU, and each chunk
+ * runs the sequential map or reduce of core.zf in a worker context, spawned
+ * from the dictionary of the caller, on its own thread. The chunk is copied
+ * into the memory of the worker at the same address, and for pmap the
+ * results are copied back. For preduce each worker folds its chunk into its
+ * first cell, and the first worker then folds the results of all of them
+ * into 'init'.
+ */
+
+#define PMAP_WORKERS 64
+
+typedef struct
+{
+    zf_ctx *ctx;
+    pthread_t tid;
+    bool reduce;
+    zf_cell xt;
+    zf_cell init;
+    zf_addr src;
+    zf_addr dst;
+    size_t n;
+    zf_result r;
+    zf_cell v;
+} pmap_worker;
+
+static void *pmap_run(void *arg)
+{
+    pmap_worker *w = arg;
+
+    zf_ctx_push(w->ctx, w->xt);
+    if (w->reduce)
+        zf_ctx_push(w->ctx, w->init);
+    zf_ctx_push(w->ctx, w->src);
+    if (!w->reduce)
+        zf_ctx_push(w->ctx, w->dst);
+    zf_ctx_push(w->ctx, w->n);
+    w->r = zf_ctx_eval(w->ctx, w->reduce ? "reduce" : "map");
+    if (w->r == ZF_OK && w->reduce)
+    {
+        zf_ctx *prev = zf_ctx_select(w->ctx);
+        if (zf_dstack_count() > 0)
+            w->v = zf_pop();
+        else
+            w->r = ZF_ABORT_DSTACK_UNDERRUN;
+        zf_ctx_select(prev);
+    }
+    return NULL;
+}
+
+static void pmap(zf_ctx *caller, bool reduce)
+{
+    static long cpus;
+    pmap_worker ws[PMAP_WORKERS];
+    size_t n = zf_pop();
+    zf_addr dst = reduce ? 0 : zf_pop();
+    zf_addr src = zf_pop();
+    zf_cell init = reduce ? zf_pop() : 0;
+    zf_cell xt = zf_pop();
+    size_t size, cell = sizeof(zf_cell);
+    uint8_t *mem = zf_dump(&size);
+    size_t count, i, at = 0;
+    zf_result r = ZF_OK;
+
+    if (n > size / cell || src > size - n * cell || dst > size - n * cell)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    if (n == 0)
+    {
+        if (reduce)
+            zf_push(init);
+        return;
+    }
+    if (cpus == 0)
+        cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    count = cpus < 1 ? 1 : cpus > PMAP_WORKERS ? PMAP_WORKERS : (size_t)cpus;
+    if (count > n)
+        count = n;
+    if (zf_ctx_share(caller) != ZF_OK)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+
+    for (i = 0; i < count; i++)
+    {
+        pmap_worker *w = &ws[i];
+        size_t len = n / count + (i < n % count);
+
+        w->ctx = zf_ctx_spawn(caller);
+        if (w->ctx == NULL)
+        {
+            r = ZF_ABORT_OUTSIDE_MEM;
+            break;
+        }
+        zf_ctx_select(w->ctx);
+        memcpy((uint8_t *)zf_dump(NULL) + src + at * cell, mem + src + at * cell, len * cell);
+        zf_ctx_select(caller);
+        w->reduce = reduce;
+        w->xt = xt;
+        w->init = init;
+        w->src = src + at * cell;
+        w->dst = dst + at * cell;
+        w->n = len;
+        if (reduce)
+        {
+            memcpy(&w->init, mem + w->src, cell);
+            w->src += cell;
+            w->n--;
+        }
+        at += len;
+        if (pthread_create(&w->tid, NULL, pmap_run, w) != 0)
+        {
+            interp_free(w->ctx);
+            r = ZF_ABORT_OUTSIDE_MEM;
+            break;
+        }
+    }
+    count = i;
+
+    for (i = 0; i < count; i++)
+    {
+        pthread_join(ws[i].tid, NULL);
+        if (r == ZF_OK)
+            r = ws[i].r;
+    }
+
+    if (r == ZF_OK && !reduce)
+    {
+        for (i = 0; i < count; i++)
+        {
+            zf_ctx_select(ws[i].ctx);
+            memcpy(mem + ws[i].dst, (uint8_t *)zf_dump(NULL) + ws[i].dst, ws[i].n * cell);
+        }
+        zf_ctx_select(caller);
+    }
+
+    if (r == ZF_OK && reduce)
+    {
+        /* The chunk of the first worker holds at least one cell per worker */
+        pmap_worker w0 = ws[0];
+        zf_ctx_select(w0.ctx);
+        for (i = 0; i < count; i++)
+            memcpy((uint8_t *)zf_dump(NULL) + src + i * cell, &ws[i].v, cell);
+        zf_ctx_select(caller);
+        w0.init = init;
+        w0.src = src;
+        w0.n = count;
+        pmap_run(&w0);
+        r = w0.r;
+        ws[0].v = w0.v;
+    }
+
+    for (i = 0; i < count; i++)
+        interp_free(ws[i].ctx);
+    if (r != ZF_OK)
+        zf_abort(r);
+    if (reduce)
+        zf_push(ws[0].v);
+}
+
+/*
+ * Hosted interpreters: a script drives another interpreter through the C API,
+ * as a host does. 'interp' spawns one from the dictionary of the caller, see
+ * zf_ctx_spawn(), and the other words take its number. Evaluations and calls
+ * return their zf_result, ZF_RUNNING for a sliced evaluation which is not
+ * done yet. Only the interpreter which spawned one can use it, and it is
+ * freed with it.
+ */
+
+#define INTERPS 64
+#define INTERP_SNAPSHOT (1024 * 1024)
+
+typedef struct
+{
+    zf_ctx *ctx;
+    zf_ctx *owner;
+    char *src;  /* source of a sliced evaluation, kept until it is done */
+    void *snap; /* active snapshot, see zf_snapshot() */
+} interp_t;
+
+static interp_t interps[INTERPS];
+static pthread_mutex_t interp_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static interp_t *interp_get(zf_cell n)
+{
+    interp_t *in;
+    bool ok;
+
+    if (n < 0 || n >= INTERPS)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    in = &interps[(int)n];
+    pthread_mutex_lock(&interp_lock);
+    ok = in->ctx != NULL && in->owner == zf_ctx_current();
+    pthread_mutex_unlock(&interp_lock);
+    if (!ok)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    return in;
+}
+
+static void interp_clear(interp_t *in)
+{
+    zf_ctx *c = in->ctx;
+
+    free(in->src);
+    free(in->snap);
+    pthread_mutex_lock(&interp_lock);
+    memset(in, 0, sizeof(*in));
+    pthread_mutex_unlock(&interp_lock);
+    interp_free(c);
+}
+
+/* Free the interpreters spawned by 'owner', which is being freed */
+
+static void interp_release(zf_ctx *owner)
+{
+    for (int n = 0; n < INTERPS; n++)
+    {
+        pthread_mutex_lock(&interp_lock);
+        bool owned = interps[n].ctx != NULL && interps[n].owner == owner;
+        pthread_mutex_unlock(&interp_lock);
+        if (owned)
+            interp_clear(&interps[n]);
+    }
+}
+
+static void interp_spawn(zf_ctx *caller)
+{
+    zf_ctx *c;
+    int n;
+
+    if (zf_ctx_share(caller) != ZF_OK || (c = zf_ctx_spawn(caller)) == NULL)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    pthread_mutex_lock(&interp_lock);
+    for (n = 0; n < INTERPS && interps[n].ctx != NULL; n++)
+        ;
+    if (n < INTERPS)
+    {
+        interps[n].ctx = c;
+        interps[n].owner = caller;
+    }
+    pthread_mutex_unlock(&interp_lock);
+    if (n == INTERPS)
+    {
+        interp_free(c);
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    }
+    zf_push(n);
+}
+
+/* Copy of the string at 'addr' in the memory of the caller */
+
+static char *interp_src(zf_cell addr, size_t len)
+{
+    char *src = malloc(len + 1);
+    if (src == NULL)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    memcpy(src, channel_mem(addr, len), len);
+    src[len] = '\0';
+    return src;
+}
+
+static void interp_sys(zf_ctx *caller, int id)
+{
+    interp_t *in;
+    zf_result r = ZF_OK;
+
+    if (id == 171)
+    {
+        interp_spawn(caller);
+        return;
+    }
+    in = interp_get(zf_pop());
+
+    switch (id)
+    {
+    case 172: // interp-free ( i -- )
+        interp_clear(in);
+        return;
+
+    case 173: // interp-push ( v i -- )
+        zf_ctx_push(in->ctx, zf_pop());
+        return;
+
+    case 174: // interp-pop ( i -- v )
+    {
+        zf_ctx_select(in->ctx);
+        bool empty = zf_dstack_count() == 0;
+        zf_cell v = empty ? 0 : zf_pop();
+        zf_ctx_select(caller);
+        if (empty)
+            zf_abort(ZF_ABORT_DSTACK_UNDERRUN);
+        zf_push(v);
+        return;
+    }
+
+    case 175: // interp-eval ( addr len i -- r )
+    {
+        size_t len = zf_pop();
+        char *src = interp_src(zf_pop(), len);
+        r = zf_ctx_eval(in->ctx, src);
+        free(src);
+        break;
+    }
+
+    case 176: // interp-slice ( addr len budget i -- r )
+    {
+        uint32_t budget = zf_pop();
+        size_t len = zf_pop();
+        char *src = interp_src(zf_pop(), len);
+        zf_ctx_select(in->ctx);
+        r = zf_eval_slice(src, budget);
+        zf_ctx_select(caller);
+        free(in->src);
+        in->src = src;
+        break;
+    }
+
+    case 177: // interp-resume ( budget i -- r )
+    {
+        uint32_t budget = zf_pop();
+        zf_ctx_select(in->ctx);
+        r = zf_run_slice(budget);
+        zf_ctx_select(caller);
+        break;
+    }
+
+    case 178: // interp-cancel ( i -- r )
+        zf_ctx_select(in->ctx);
+        r = zf_run_cancel();
+        zf_ctx_select(caller);
+        break;
+
+    case 179: // interp-call ( xt i -- r )
+    {
+        zf_addr xt = zf_pop();
+        zf_ctx_select(in->ctx);
+        r = zf_call(xt);
+        zf_ctx_select(caller);
+        break;
+    }
+
+    case 180: // interp-snapshot ( i -- )
+        if (in->snap == NULL && (in->snap = malloc(INTERP_SNAPSHOT)) == NULL)
+            zf_abort(ZF_ABORT_OUTSIDE_MEM);
+        zf_ctx_select(in->ctx);
+        r = zf_snapshot(in->snap, INTERP_SNAPSHOT) ? ZF_OK : ZF_ABORT_INVALID_SIZE;
+        zf_ctx_select(caller);
+        if (r != ZF_OK)
+            zf_abort(r);
+        return;
+
+    case 181: // interp-restore ( i -- )
+        if (in->snap == NULL)
+            zf_abort(ZF_ABORT_INVALID_SIZE);
+        zf_ctx_select(in->ctx);
+        zf_restore(in->snap);
+        zf_ctx_select(caller);
+        free(in->snap);
+        in->snap = NULL;
+        break;
+    }
+
+    if (id >= 176 && id <= 178 && r != ZF_RUNNING && in->src != NULL)
+    {
+        free(in->src);
+        in->src = NULL;
+    }
+    if (id != 181)
+        zf_push(r);
 }
 
 /*
  * Sys callback function
  */
 
-zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
+zf_input_state zf_host_sys(zf_ctx *ctx, zf_syscall_id id, const char *input)
 {
     switch ((int)id)
     {
         /* The core system callbacks */
 
     case ZF_SYSCALL_EMIT:
-        putchar((char)zf_pop());
-        fflush(stdout);
+        fputc((char)zf_pop(), OUT);
+        fflush(OUT);
         break;
 
     case ZF_SYSCALL_PRINT:
-        printf(ZF_CELL_FMT " ", zf_pop());
+        fprintf(OUT, ZF_CELL_FMT " ", zf_pop());
         break;
 
     case ZF_SYSCALL_TYPE:
     {
         zf_cell len = zf_pop();
         void *buf = (uint8_t *)zf_dump(NULL) + (int)zf_pop();
-        (void)fwrite(buf, 1, len, stdout);
-        fflush(stdout);
+        (void)fwrite(buf, 1, len, OUT);
+        fflush(OUT);
     }
     break;
 
     case ZF_SYSCALL_KEY:
-        break;
+    {
+        unsigned char ch = 0;
+        fflush(OUT);
+        zf_push(read(0, &ch, 1) == 1 ? ch : -1);
+    }
+    break;
 
         /* Application specific callbacks */
 
@@ -178,7 +951,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
             return ZF_INPUT_PASS_WORD;
         }
         include(input);
-        printf("\n");
+        fprintf(OUT, "\n");
         break;
 
     case ZF_SYSCALL_USER + 1: // accept
@@ -187,7 +960,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
         char *buffer = (char *)(zf_dump(NULL) + (int)addr);
         int len = zf_pop();
         char *text = (char *)(zf_dump(NULL) + (int)zf_pop());
-        fwrite(text, 1, len, stdout);
+        fwrite(text, 1, len, OUT);
         scanf("%s", buffer);
         zf_push(addr);
         zf_push(strlen(buffer));
@@ -197,17 +970,20 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
     case ZF_SYSCALL_USER + 2: // .s
     {
         int count = zf_dstack_count();
-        printf("<%d>", count);
+        fprintf(OUT, "<%d>", count);
         for (int i = count - 1; i >= 0; i--)
         {
-            printf(" " ZF_CELL_FMT, zf_pick(i));
+            fprintf(OUT, " " ZF_CELL_FMT, zf_pick(i));
         }
-        printf("\n");
+        fprintf(OUT, "\n");
     }
     break;
 
-    case ZF_SYSCALL_USER + 3: // bye
-        exit(0);
+    case ZF_SYSCALL_USER + 3: // bye, which only ends the job in batch mode
+        if (!job_out)
+            exit(0);
+        job_bye = true;
+        zf_abort(ZF_ABORT_INTERRUPT);
         break;
 
     case ZF_SYSCALL_USER + 4: // save
@@ -215,7 +991,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
         {
             return ZF_INPUT_PASS_WORD;
         }
-        save(input);
+        save(input, ZF_IMAGE_STACKS);
         break;
 
     case ZF_SYSCALL_USER + 5: // load
@@ -229,7 +1005,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
     case ZF_SYSCALL_USER + 6: // date&time ( – nsec nmin nhour nday nmonth nyear )
     {
         time_t now = time(NULL);
-        struct tm *tm = localtime(&now);
+        struct tm tm_buf, *tm = localtime_r(&now, &tm_buf);
         zf_push(tm->tm_sec);
         zf_push(tm->tm_min);
         zf_push(tm->tm_hour);
@@ -246,7 +1022,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
     case ZF_SYSCALL_USER + 8: // .date
     {
         time_t now = zf_pop();
-        struct tm *tm = localtime(&now);
+        struct tm tm_buf, *tm = localtime_r(&now, &tm_buf);
         zf_host_print("%2d/%02d/%4d", tm->tm_mday, tm->tm_mon, tm->tm_year + 1900);
         break;
     }
@@ -254,11 +1030,76 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
     case ZF_SYSCALL_USER + 9: // .time
     {
         time_t now = zf_pop();
-        struct tm *tm = localtime(&now);
+        struct tm tm_buf, *tm = localtime_r(&now, &tm_buf);
         zf_host_print("%02d:%02d:%02d", tm->tm_hour, tm->tm_min, tm->tm_sec);
         break;
     }
 
+    case ZF_SYSCALL_USER + 10: // export ( "entry" "file" - )
+    case ZF_SYSCALL_USER + 11: // export-stripped ( "entry" "file" - )
+    {
+        static _Thread_local char entry[32];
+        if (input == NULL)
+        {
+            entry[0] = '\0';
+            return ZF_INPUT_PASS_WORD;
+        }
+        if (entry[0] == '\0')
+        {
+            snprintf(entry, sizeof(entry), "%s", input);
+            return ZF_INPUT_PASS_WORD;
+        }
+        export(entry, input, id == ZF_SYSCALL_USER + 11 ? ZF_EXPORT_STRIP : 0);
+        entry[0] = '\0';
+        break;
+    }
+
+    case 153: // ticks ( -- ms )
+    {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        zf_push((zf_cell)now.tv_sec * 1000 + now.tv_nsec / 1000000);
+    }
+    break;
+
+    case 154: // key? ( -- flag )
+    {
+        struct pollfd pfd = {.fd = 0, .events = POLLIN};
+        zf_push(poll(&pfd, 1, 0) > 0);
+    }
+    break;
+
+    case 160:
+    case 161:
+    case 162:
+    case 163:
+    case 164:
+    case 165:
+    case 166:
+    case 167:
+    case 168:
+        channel_sys(id);
+        break;
+
+    case 169: // pmap ( xt src dst n -- )
+    case 170: // preduce ( xt init src n -- r )
+        pmap(ctx, id == 170);
+        break;
+
+    case 171:
+    case 172:
+    case 173:
+    case 174:
+    case 175:
+    case 176:
+    case 177:
+    case 178:
+    case 179:
+    case 180:
+    case 181:
+        interp_sys(ctx, id);
+        break;
+
     case 140: // sin
         zf_push(sin(zf_pop()));
         break;
@@ -316,7 +1157,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
         break;
 
     default:
-        printf("unhandled syscall %d\n", id);
+        fprintf(OUT, "unhandled syscall %d\n", id);
         break;
     }
 
@@ -329,24 +1170,76 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
 
 void zf_host_trace(const char *fmt, va_list va)
 {
-    fprintf(stderr, "\033[1;36m");
-    vfprintf(stderr, fmt, va);
-    fprintf(stderr, "\033[0m");
+    fprintf(ERR, "\033[1;36m");
+    vfprintf(ERR, fmt, va);
+    fprintf(ERR, "\033[0m");
 }
 
 void zf_host_print(const char *fmt, ...)
 {
     va_list arg;
     va_start(arg, fmt);
-    vfprintf(stderr, fmt, arg);
+    vfprintf(ERR, fmt, arg);
     va_end(arg);
 }
 
+/*
+ * Block storage in a plain file, opened for each batch of transfers. Reading
+ * does not create the file
+ */
+
+static const char *fname_blocks = "zforth.blk";
+static _Thread_local FILE *block_file;
+
+static FILE *block_open(bool write)
+{
+    if (!block_file)
+    {
+        block_file = fopen(fname_blocks, "r+b");
+        if (!block_file && write)
+            block_file = fopen(fname_blocks, "w+b");
+    }
+    return block_file;
+}
+
+bool zf_host_block_read(unsigned int blk, void *buf)
+{
+    FILE *f = block_open(false);
+    size_t n = 0;
+
+    if (f)
+    {
+        if (fseek(f, (long)blk * ZF_BLOCK_SIZE, SEEK_SET) != 0)
+            return false;
+        n = fread(buf, 1, ZF_BLOCK_SIZE, f);
+        if (ferror(f))
+            return false;
+    }
+    memset((uint8_t *)buf + n, 0, ZF_BLOCK_SIZE - n);
+    return true;
+}
+
+bool zf_host_block_write(unsigned int blk, const void *buf)
+{
+    FILE *f = block_open(true);
+    return f && fseek(f, (long)blk * ZF_BLOCK_SIZE, SEEK_SET) == 0 &&
+           fwrite(buf, 1, ZF_BLOCK_SIZE, f) == ZF_BLOCK_SIZE;
+}
+
+void zf_host_block_done(void)
+{
+    if (block_file)
+    {
+        fclose(block_file);
+        block_file = NULL;
+    }
+}
+
 /*
  * Parse number
  */
 
-zf_cell zf_host_parse_num(const char *buf)
+zf_cell zf_host_parse_num(zf_ctx *ctx, const char *buf)
 {
     zf_cell v;
     int r = sscanf(buf, "%lf", &v);
@@ -361,18 +1254,188 @@ void zf_host_printf(const char *fmt, ...)
 {
     va_list params;
     va_start(params, fmt);
-    vprintf(fmt, params);
+    vfprintf(OUT, fmt, params);
     va_end(params);
 }
 
+/*
+ * Parse a memory size with an optional k or M suffix
+ */
+
+static zf_addr parse_size(const char *arg)
+{
+    char *end;
+    unsigned long v = strtoul(arg, &end, 0);
+    if (*end == 'k' || *end == 'K')
+        v *= 1024;
+    else if (*end == 'm' || *end == 'M')
+        v *= 1024 * 1024;
+    return v;
+}
+
+/*
+ * Batch mode: run each source file as a job in its own interpreter, on a pool
+ * of worker threads. The image given with -l or -m, or a bootstrapped
+ * dictionary, is loaded once and shared by all jobs, see zf_ctx_spawn(). The
+ * output of the jobs is printed in job order as soon as it is complete,
+ * followed by a summary.
+ */
+
+typedef struct
+{
+    const char *fname;
+    char *out;
+    size_t out_len;
+    int errors;
+    double ms;
+    bool done;
+} job_t;
+
+typedef struct
+{
+    job_t *jobs;
+    int count;
+    int next;
+    zf_ctx *core;
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+} batch_t;
+
+static double ms_since(const struct timespec *start)
+{
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (now.tv_sec - start->tv_sec) * 1e3 + (now.tv_nsec - start->tv_nsec) / 1e6;
+}
+
+static void run_job(batch_t *b, job_t *job)
+{
+    struct timespec start;
+    clock_gettime(CLOCK_MONOTONIC, &start);
+
+    job_out = open_memstream(&job->out, &job->out_len);
+    job_errors = 0;
+    job_bye = false;
+
+    zf_ctx *ctx = zf_ctx_spawn(b->core);
+    if (ctx == NULL)
+    {
+        fprintf(job_out, "can not allocate interpreter memory\n");
+        job_errors++;
+    }
+    else
+    {
+        zf_ctx_select(ctx);
+        include(job->fname);
+        zf_ctx_select(NULL);
+        interp_free(ctx);
+    }
+
+    fclose(job_out);
+    job_out = NULL;
+    job->errors = job_errors;
+    job->ms = ms_since(&start);
+}
+
+static void *worker(void *arg)
+{
+    batch_t *b = (batch_t *)arg;
+
+    for (;;)
+    {
+        pthread_mutex_lock(&b->lock);
+        int i = b->next < b->count ? b->next++ : -1;
+        pthread_mutex_unlock(&b->lock);
+        if (i < 0)
+            break;
+
+        run_job(b, &b->jobs[i]);
+
+        pthread_mutex_lock(&b->lock);
+        b->jobs[i].done = true;
+        pthread_cond_broadcast(&b->cond);
+        pthread_mutex_unlock(&b->lock);
+    }
+    return NULL;
+}
+
+static int run_jobs(batch_t *b, int threads, const char **fnames, int count)
+{
+    struct timespec start;
+    int failed = 0;
+
+    if (threads > count)
+        threads = count > 0 ? count : 1;
+    pthread_t tid[threads];
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    b->jobs = calloc(count, sizeof(job_t));
+    b->count = count;
+    b->next = 0;
+    for (int i = 0; i < count; i++)
+        b->jobs[i].fname = fnames[i];
+    pthread_mutex_init(&b->lock, NULL);
+    pthread_cond_init(&b->cond, NULL);
+
+    for (int i = 0; i < threads; i++)
+    {
+        if (pthread_create(&tid[i], NULL, worker, b) != 0)
+        {
+            fprintf(stderr, "can not create worker thread\n");
+            exit(1);
+        }
+    }
+
+    for (int i = 0; i < count; i++)
+    {
+        job_t *job = &b->jobs[i];
+        pthread_mutex_lock(&b->lock);
+        while (!job->done)
+            pthread_cond_wait(&b->cond, &b->lock);
+        pthread_mutex_unlock(&b->lock);
+        fwrite(job->out, 1, job->out_len, stdout);
+        fflush(stdout);
+        free(job->out);
+    }
+
+    for (int i = 0; i < threads; i++)
+        pthread_join(tid[i], NULL);
+
+    fprintf(stderr, "\n");
+    for (int i = 0; i < count; i++)
+    {
+        job_t *job = &b->jobs[i];
+        if (job->errors)
+            failed++;
+        fprintf(stderr, "%-40s %9.1f ms  %s", job->fname, job->ms, job->errors ? "FAIL" : "ok");
+        if (job->errors)
+            fprintf(stderr, " (%d error%s)", job->errors, job->errors > 1 ? "s" : "");
+        fprintf(stderr, "\n");
+    }
+    fprintf(stderr, "%d jobs, %d failed, %d threads, %.1f ms\n", count, failed, threads, ms_since(&start));
+
+    free(b->jobs);
+    return failed ? 1 : 0;
+}
+
 void usage(void)
 {
     fprintf(stderr, "usage: zfort [options] [src ...]\n"
                     "\n"
                     "Options:\n"
                     "   -h         show help\n"
+                    "   -b FILE    block storage file (default zforth.blk)\n"
                     "   -t         enable tracing\n"
-                    "   -l FILE    load dictionary from FILE\n");
+                    "   -l FILE    load dictionary from FILE\n"
+                    "   -m FILE    map dictionary image FILE, sharing it with other processes\n"
+                    "   -o FILE    save dictionary image to FILE after loading sources, and exit\n"
+                    "   -d SIZE    dictionary size, with optional k or M suffix (default 64M)\n"
+                    "   -p SIZE    PAD size (default 1M)\n"
+                    "   -s SIZE    stack size (default 1M)\n"
+                    "   -x SIZE    data space size for xallot (default 256M)\n"
+                    "   -v         report startup time and memory use\n"
+                    "   -j N       run each src file as a job in its own interpreter, on N threads;\n"
+                    "              without src files, read their names from stdin\n");
 }
 
 /*
@@ -386,19 +1449,57 @@ int main(int argc, char **argv)
     int trace = 0;
     int line = 0;
     const char *fname_load = NULL;
+    const char *fname_image = NULL;
+    const char *fname_map = NULL;
+    int verbose = 0;
+    int threads = 0;
+    zf_addr dict_size = 64 * 1024 * 1024;
+    zf_addr pad_size = 1024 * 1024;
+    zf_addr stack_size = 1024 * 1024;
+    zf_addr data_size = 256 * 1024 * 1024;
+    struct timespec start;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
 
     /* Parse command line options */
 
-    while ((c = getopt(argc, argv, "hl:t")) != -1)
+    while ((c = getopt(argc, argv, "b:d:hj:l:m:o:p:s:tvx:")) != -1)
     {
         switch (c)
         {
         case 't':
             trace = 1;
             break;
+        case 'b':
+            fname_blocks = optarg;
+            break;
         case 'l':
             fname_load = optarg;
             break;
+        case 'm':
+            fname_map = optarg;
+            break;
+        case 'o':
+            fname_image = optarg;
+            break;
+        case 'v':
+            verbose = 1;
+            break;
+        case 'j':
+            threads = atoi(optarg);
+            break;
+        case 'd':
+            dict_size = parse_size(optarg);
+            break;
+        case 'p':
+            pad_size = parse_size(optarg);
+            break;
+        case 's':
+            stack_size = parse_size(optarg);
+            break;
+        case 'x':
+            data_size = parse_size(optarg);
+            break;
         case 'h':
             usage();
             exit(0);
@@ -408,18 +1509,62 @@ int main(int argc, char **argv)
     argc -= optind;
     argv += optind;
 
+    if (threads > 0)
+    {
+        batch_t batch = {.core = zf_ctx_new(trace, dict_size, pad_size, stack_size, data_size)};
+        const char *image = fname_map ? fname_map : fname_load;
+        const char **fnames = (const char **)argv;
+        int count = argc;
+
+        if (batch.core == NULL)
+        {
+            fprintf(stderr, "can not allocate interpreter memory\n");
+            exit(1);
+        }
+        zf_ctx_select(batch.core);
+        if (image == NULL)
+            zf_bootstrap();
+        else if (load(image) != 0)
+            exit(1);
+        if (zf_ctx_share(batch.core) != ZF_OK)
+        {
+            fprintf(stderr, "can not share the dictionary\n");
+            exit(1);
+        }
+        zf_ctx_select(NULL);
+        if (count == 0)
+        {
+            char buf[PATH_MAX];
+            fnames = NULL;
+            while (fgets(buf, sizeof(buf), stdin))
+            {
+                buf[strcspn(buf, "\r\n")] = '\0';
+                if (buf[0] == '\0')
+                    continue;
+                fnames = realloc(fnames, (count + 1) * sizeof(*fnames));
+                fnames[count++] = strdup(buf);
+            }
+        }
+        return run_jobs(&batch, threads, fnames, count);
+    }
+
     /* Initialize zforth */
 
-    zf_init(trace);
+    if (zf_init(trace, dict_size, pad_size, stack_size, data_size) != ZF_OK)
+    {
+        fprintf(stderr, "can not allocate interpreter memory\n");
+        exit(1);
+    }
 
     /* Load dict from disk if requested, otherwise bootstrap fort
    * dictionary */
 
-    if (fname_load)
+    if (fname_map)
     {
-        load(fname_load);
+        if (map(fname_map) != 0)
+            exit(1);
     }
-    else
+    else if (fname_load == NULL || load(fname_load) != 0)
     {
         zf_bootstrap();
     }
@@ -431,6 +1576,16 @@ int main(int argc, char **argv)
         include(argv[i]);
     }
 
+    if (fname_image)
+    {
+        return save(fname_image, 0) == 0 ? 0 : 1;
+    }
+
+    if (verbose)
+    {
+        stats(&start);
+    }
+
     /* Interactive interpreter: read a line using readline library,
    * and pass to zf_eval() for evaluation*/
 
@@ -10,11 +10,17 @@
 
 #include "alpha.h"
 #include "zcore.h"
+#include "zimage.h"
 
 history_t history = {NULL, NULL, ""};
 static char *bufIn = history.buffer;
 static int bufIn_pos = 0;
 static bool output;
+static bool preview;
+
+#define EVAL_SLICE 10000 /* instructions between two checks of the EXIT key */
+#define PREVIEW_SLICE 2000 /* instructions of the live preview */
+#define PREVIEW_SIZE 4096  /* snapshot of the live preview: context, stacks, heap and undo log */
 
 /*
 --------------------------------------------------------------------
@@ -164,13 +170,30 @@ int forth_eval(const char *buf)
     fReg->lnfill = 0;
     output = false;
 
-    zf_result r = zf_eval(buf);
+    /* Run in slices, so a long computation can be interrupted with EXIT */
+    uint32_t start = sys_current_ms();
+    bool busy = false;
+    zf_result r = zf_eval_slice(buf, EVAL_SLICE);
+    while (r == ZF_RUNNING)
+    {
+        if (sys_last_key() == KEY_EXIT)
+        {
+            r = zf_run_cancel();
+            break;
+        }
+        if (!busy && sys_current_ms() - start > 500)
+        {
+            header(t20, "Running, EXIT to interrupt");
+            busy = true;
+        }
+        r = zf_run_slice(EVAL_SLICE);
+    }
 
     fReg->lnfill = 1;
     fReg->xspc = xspc;
     fReg->fixed = fixed_font;
 
-    char *msg;
+    char *msg, thrown[48];
     switch (r)
     {
     case ZF_OK:
@@ -212,8 +235,22 @@ int forth_eval(const char *buf)
     case ZF_ABORT_INTERRUPT:
         msg = "Interrupt";
         break;
+    case ZF_ABORT_OUTSIDE_PAD:
+        msg = "Outside PAD memory";
+        break;
+    case ZF_ABORT_BLOCK_IO:
+        msg = "Block I/O error";
+        break;
+    case ZF_RUNNING:
+        msg = "Not finished";
+        break;
+    case ZF_ABORT_THROW:
+        snprintf(thrown, sizeof(thrown), "Uncaught throw " ZF_CELL_FMT, zf_throw_code());
+        msg = thrown;
+        break;
     default:
-        msg = "unknown error";
+        snprintf(thrown, sizeof(thrown), "Unknown error %d", r);
+        msg = thrown;
     }
     if (msg != NULL)
     {
@@ -249,6 +286,31 @@ int forth_eval(const char *buf)
     return 0;
 }
 
+/* Evaluate the input line on a snapshot of the interpreter, with a small
+ * instruction budget, and print the top of the stack it leaves in 'result'.
+ * The snapshot is restored, so the line has no effect. Returns 0 if there is
+ * a result to show */
+
+int forth_preview(const char *buf, char *result, size_t len)
+{
+    static zf_cell snapshot[PREVIEW_SIZE / sizeof(zf_cell)];
+    int rc = -1;
+
+    if (buf == NULL || strlen(buf) == 0)
+        return -1;
+    if (zf_snapshot(snapshot, sizeof(snapshot)) == 0)
+        return -1;
+    preview = true;
+    if (zf_eval_slice(buf, PREVIEW_SLICE) == ZF_OK && zf_dstack_count() > 0)
+    {
+        snprintf(result, len, ZF_CELL_FMT, zf_pick(0));
+        rc = 0;
+    }
+    preview = false;
+    zf_restore(snapshot);
+    return rc;
+}
+
 int include(const char *filename)
 {
     FIL f;
@@ -277,6 +339,173 @@ int include(const char *filename)
     return 0;
 }
 
+/*
+ * Dictionary images on the calculator disk and in flash
+ */
+
+static size_t file_write(void *arg, const void *buf, size_t len)
+{
+    unsigned int n;
+    if (f_write((FIL *)arg, buf, len, &n) != FR_OK)
+        return 0;
+    return n;
+}
+
+static size_t file_read(void *arg, void *buf, size_t len)
+{
+    unsigned int n;
+    if (f_read((FIL *)arg, buf, len, &n) != FR_OK)
+        return 0;
+    return n;
+}
+
+typedef struct
+{
+    const uint8_t *p;
+    size_t left;
+} image_buf_t;
+
+static size_t buf_read(void *arg, void *buf, size_t len)
+{
+    image_buf_t *b = (image_buf_t *)arg;
+    if (len > b->left)
+        len = b->left;
+    memcpy(buf, b->p, len);
+    b->p += len;
+    b->left -= len;
+    return len;
+}
+
+/*
+ * Block storage in one file on the calculator disk. The file is opened for a
+ * batch of transfers and closed by zf_host_block_done(); writes enable the
+ * disk only for the batch. Reading does not create the file
+ */
+
+#define BLOCK_FILE "/FORTH/zforth.blk"
+
+static FIL block_file;
+static int block_mode; /* 0 closed, FA_READ or FA_WRITE */
+
+static bool block_open(int mode)
+{
+    if (block_mode == mode || block_mode == FA_WRITE)
+        return true;
+    zf_host_block_done();
+    if (mode == FA_WRITE)
+    {
+        sys_disk_write_enable(1);
+        if (f_open(&block_file, BLOCK_FILE, FA_READ | FA_WRITE | FA_OPEN_ALWAYS) != FR_OK)
+        {
+            sys_disk_write_enable(0);
+            return false;
+        }
+    }
+    else if (f_open(&block_file, BLOCK_FILE, FA_READ) != FR_OK)
+    {
+        return false;
+    }
+    block_mode = mode;
+    return true;
+}
+
+bool zf_host_block_read(unsigned int blk, void *buf)
+{
+    unsigned int n = 0;
+
+    if (block_open(FA_READ))
+    {
+        FSIZE_t at = (FSIZE_t)blk * ZF_BLOCK_SIZE;
+        if (at < f_size(&block_file) &&
+            (f_lseek(&block_file, at) != FR_OK || f_read(&block_file, buf, ZF_BLOCK_SIZE, &n) != FR_OK))
+            return false;
+    }
+    memset((uint8_t *)buf + n, 0, ZF_BLOCK_SIZE - n);
+    return true;
+}
+
+bool zf_host_block_write(unsigned int blk, const void *buf)
+{
+    unsigned int n;
+    return block_open(FA_WRITE) &&
+           f_lseek(&block_file, (FSIZE_t)blk * ZF_BLOCK_SIZE) == FR_OK &&
+           f_write(&block_file, buf, ZF_BLOCK_SIZE, &n) == FR_OK && n == ZF_BLOCK_SIZE;
+}
+
+void zf_host_block_done(void)
+{
+    if (block_mode)
+    {
+        f_close(&block_file);
+        if (block_mode == FA_WRITE)
+            sys_disk_write_enable(0);
+        block_mode = 0;
+    }
+}
+
+int save(const char *filename)
+{
+    FIL f;
+    sys_disk_write_enable(1);
+    FRESULT r = f_open(&f, filename, FA_WRITE | FA_CREATE_ALWAYS);
+    if (r != FR_OK)
+    {
+        sys_disk_write_enable(0);
+        alert("Error in open file");
+        return -1;
+    }
+    size_t len = zf_image_save(file_write, &f, ZF_IMAGE_STACKS);
+    r = f_close(&f);
+    sys_disk_write_enable(0);
+    if (len == 0 || r != FR_OK)
+    {
+        alert("Error in writing file");
+        return -1;
+    }
+    return 0;
+}
+
+int export(const char *entry, const char *filename, int flags)
+{
+    FIL f;
+    sys_disk_write_enable(1);
+    FRESULT r = f_open(&f, filename, FA_WRITE | FA_CREATE_ALWAYS);
+    if (r != FR_OK)
+    {
+        sys_disk_write_enable(0);
+        alert("Error in open file");
+        return -1;
+    }
+    size_t len = zf_export(entry, flags, file_write, &f);
+    r = f_close(&f);
+    sys_disk_write_enable(0);
+    if (len == 0 || r != FR_OK)
+    {
+        alert("Error in exporting");
+        return -1;
+    }
+    return 0;
+}
+
+int load(const char *filename)
+{
+    FIL f;
+    FRESULT r = f_open(&f, filename, FA_READ);
+    if (r != FR_OK)
+    {
+        alert("Error in open file");
+        return -1;
+    }
+    zf_result rv = zf_image_load(file_read, &f);
+    f_close(&f);
+    if (rv != ZF_OK)
+    {
+        alert("Invalid image file");
+        return -1;
+    }
+    return 0;
+}
+
 int forth_getVar(const char *name, double *value)
 {
     char code[32];
@@ -291,17 +520,28 @@ int forth_getVar(const char *name, double *value)
 
 int forth_init()
 {
-    zf_init(0);
+    zf_init(0, ZF_DICT_SIZE, ZF_PAD_SIZE, ZF_STACK_SIZE, ZF_DATA_SIZE);
+
+    /* Start from the precompiled dictionary, or compile the core sources
+     * if the image does not match this build */
+    image_buf_t image = {all_zfi, all_zfi_len};
+    if (zf_image_load(buf_read, &image) == ZF_OK)
+        return 0;
+
     zf_bootstrap();
 
     return forth_eval((const char *)all_zf);
 }
 
-zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
+zf_input_state zf_host_sys(zf_ctx *ctx, zf_syscall_id id, const char *input)
 {
     if (sys_last_key() == KEY_EXIT)
         zf_abort(ZF_ABORT_INTERRUPT);
 
+    /* The preview runs the math words only, the others have side effects */
+    if (preview && (id < 140 || id > 154))
+        zf_abort(ZF_ABORT_INTERRUPT);
+
     switch ((int)id)
     {
     case ZF_SYSCALL_EMIT:
@@ -383,7 +623,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
         {
             return ZF_INPUT_PASS_WORD;
         }
-        // save(input);
+        save(input);
         break;
 
     case ZF_SYSCALL_USER + 5: // load
@@ -391,7 +631,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
         {
             return ZF_INPUT_PASS_WORD;
         }
-        // load(input);
+        load(input);
         break;
 
     case ZF_SYSCALL_USER + 6: // date&time ( – nsec nmin nhour nday nmonth nyear )
@@ -435,6 +675,33 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
         break;
     }
 
+    case ZF_SYSCALL_USER + 10: // export ( "entry" "file" - )
+    case ZF_SYSCALL_USER + 11: // export-stripped ( "entry" "file" - )
+    {
+        static char entry[32];
+        if (input == NULL)
+        {
+            entry[0] = '\0';
+            return ZF_INPUT_PASS_WORD;
+        }
+        if (entry[0] == '\0')
+        {
+            snprintf(entry, sizeof(entry), "%s", input);
+            return ZF_INPUT_PASS_WORD;
+        }
+        export(entry, input, id == ZF_SYSCALL_USER + 11 ? ZF_EXPORT_STRIP : 0);
+        entry[0] = '\0';
+        break;
+    }
+
+    case 153: // ticks ( -- ms )
+        zf_push(sys_current_ms());
+        break;
+
+    case 154: // key? ( -- flag )
+        zf_push(!key_empty());
+        break;
+
     case 140: // sin
         zf_push(sin(zf_pop()));
         break;
@@ -546,7 +813,7 @@ zf_input_state zf_host_sys(zf_syscall_id id, const char *input)
 
 void zf_host_trace(const char *fmt, va_list va) {}
 
-zf_cell zf_host_parse_num(const char *buf)
+zf_cell zf_host_parse_num(zf_ctx *ctx, const char *buf)
 {
     zf_cell v;
     int r = sscanf(buf, "%lf", &v);
@@ -559,6 +826,8 @@ zf_cell zf_host_parse_num(const char *buf)
 
 void zf_host_print(const char *fmt, ...)
 {
+    if (preview)
+        zf_abort(ZF_ABORT_INTERRUPT);
     char buffer[256];
     va_list arg;
     va_start(arg, fmt);
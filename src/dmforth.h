@@ -49,6 +49,7 @@ void history_add(const char *buffer);
 
 int forth_init();
 int forth_eval(const char *buf);
+int forth_preview(const char *buf, char *result, size_t len);
 int forth_getVar(const char *name, double *value);
 
 #endif
\ No newline at end of file
@@ -55,6 +55,25 @@ static void disp_input(disp_stat_t *ds, int ln)
     lcd_textToBox(ds, 0, LCD_X, buffer, 0, 0);
 }
 
+/* Result of the input line, right of it if there is room */
+
+static void disp_preview(disp_stat_t *ds, int ln)
+{
+    char result[32], text[40];
+    if (forth_preview(input(), result, sizeof(result)) != 0)
+        return;
+    snprintf(text, sizeof(text), "= %s", result);
+    int width = lcd_textWidth(ds, text);
+    if (lcd_textWidth(ds, input()) + lcd_textWidth(ds, "_ ") > LCD_X - width)
+        return;
+    lcd_setLine(ds, ln);
+    ds->y += 5;
+    ds->x = LCD_X - width;
+    ds->lnfill = 0;
+    lcd_puts(ds, text);
+    ds->lnfill = 1;
+}
+
 static void disp_input_prgm(disp_stat_t *ds, int start, int end)
 {
     static bool cursor_display = true;
@@ -131,6 +150,7 @@ static void lcd_display(char *bufin, state_t *state)
     {
         disp_stack(fReg, 1, 5);
         disp_input(fReg, 6);
+        disp_preview(fReg, 6);
         lcd_fillLines(lcd_lineHeight(fReg) * 6, 0, 2);
     }
 
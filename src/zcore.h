@@ -25,230 +25,365 @@ unsigned char all_zf[] = {
   0x20, 0x20, 0x20, 0x31, 0x33, 0x36, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b,
   0x0a, 0x3a, 0x20, 0x2e, 0x74, 0x69, 0x6d, 0x65, 0x20, 0x20, 0x20, 0x20,
   0x20, 0x20, 0x31, 0x33, 0x37, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
-  0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f, 0x6e,
-  0x61, 0x72, 0x79, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2e, 0x20,
-  0x54, 0x68, 0x65, 0x73, 0x65, 0x20, 0x61, 0x72, 0x65, 0x20, 0x73, 0x68,
-  0x6f, 0x72, 0x74, 0x63, 0x75, 0x74, 0x73, 0x20, 0x74, 0x68, 0x72, 0x6f,
-  0x75, 0x67, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6d,
-  0x69, 0x74, 0x69, 0x76, 0x65, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74,
-  0x69, 0x6f, 0x6e, 0x73, 0x20, 0x61, 0x72, 0x65, 0x20, 0x21, 0x21, 0x2c,
-  0x20, 0x40, 0x40, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x2c, 0x2c, 0x20, 0x29,
-  0x0a, 0x0a, 0x3a, 0x20, 0x21, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x21,
-  0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x21, 0x63, 0x20, 0x20, 0x20, 0x31,
-  0x20, 0x21, 0x21, 0x20, 0x3b, 0x20, 0x5c, 0x20, 0x63, 0x65, 0x6c, 0x6c,
-  0x0a, 0x3a, 0x20, 0x40, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x40, 0x40,
-  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x40, 0x63, 0x20, 0x20, 0x20, 0x31, 0x20,
-  0x40, 0x40, 0x20, 0x3b, 0x20, 0x5c, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x0a,
-  0x3a, 0x20, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x2c, 0x2c, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x2c, 0x63, 0x20, 0x20, 0x20, 0x31, 0x20, 0x2c,
-  0x2c, 0x20, 0x3b, 0x20, 0x5c, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x0a, 0x3a,
-  0x20, 0x23, 0x20, 0x20, 0x20, 0x20, 0x30, 0x20, 0x23, 0x23, 0x20, 0x3b,
-  0x0a, 0x3a, 0x20, 0x3f, 0x20, 0x20, 0x40, 0x20, 0x2e, 0x20, 0x3b, 0x0a,
-  0x0a, 0x28, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x72, 0x20,
-  0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x5b,
-  0x20, 0x30, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67,
-  0x20, 0x21, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
-  0x74, 0x65, 0x0a, 0x3a, 0x20, 0x5d, 0x20, 0x31, 0x20, 0x63, 0x6f, 0x6d,
-  0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x21, 0x20, 0x3b, 0x0a, 0x3a,
-  0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65, 0x20, 0x31, 0x20,
-  0x5f, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65, 0x20, 0x21, 0x20,
+  0x3a, 0x20, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x31, 0x33, 0x38, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a,
+  0x20, 0x65, 0x78, 0x70, 0x6f, 0x72, 0x74, 0x2d, 0x73, 0x74, 0x72, 0x69,
+  0x70, 0x70, 0x65, 0x64, 0x20, 0x31, 0x33, 0x39, 0x20, 0x73, 0x79, 0x73,
+  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x31, 0x35, 0x33, 0x20, 0x73, 0x79, 0x73, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x6b, 0x65, 0x79, 0x3f, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x31, 0x35, 0x34, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b,
+  0x0a, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x64, 0x69, 0x63, 0x74, 0x69, 0x6f,
+  0x6e, 0x61, 0x72, 0x79, 0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x2e,
+  0x20, 0x40, 0x20, 0x21, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x2c, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x69, 0x74, 0x69, 0x76, 0x65,
+  0x73, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x77, 0x68, 0x6f, 0x6c, 0x65, 0x20,
+  0x63, 0x65, 0x6c, 0x6c, 0x73, 0x2c, 0x20, 0x61, 0x6c, 0x73, 0x6f, 0x20,
+  0x6e, 0x61, 0x6d, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x40, 0x63, 0x20, 0x21,
+  0x63, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x2c, 0x63, 0x2e, 0x20, 0x40, 0x76,
+  0x20, 0x21, 0x76, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x2c, 0x76, 0x20, 0x61,
+  0x72, 0x65, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x76,
+  0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x6c, 0x65, 0x6e, 0x67,
+  0x74, 0x68, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x6f, 0x66, 0x20,
+  0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x0a, 0x20, 0x20, 0x63,
+  0x6f, 0x64, 0x65, 0x2c, 0x20, 0x21, 0x76, 0x20, 0x6b, 0x65, 0x65, 0x70,
+  0x69, 0x6e, 0x67, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x69, 0x7a, 0x65,
+  0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x65, 0x6c, 0x6c,
+  0x20, 0x69, 0x74, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x77, 0x72, 0x69, 0x74,
+  0x65, 0x73, 0x2e, 0x20, 0x40, 0x75, 0x38, 0x20, 0x40, 0x73, 0x38, 0x20,
+  0x40, 0x75, 0x31, 0x36, 0x20, 0x40, 0x73, 0x31, 0x36, 0x0a, 0x20, 0x20,
+  0x40, 0x75, 0x33, 0x32, 0x20, 0x40, 0x73, 0x33, 0x32, 0x20, 0x21, 0x38,
+  0x20, 0x21, 0x31, 0x36, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x21, 0x33, 0x32,
+  0x20, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x20, 0x69, 0x6e, 0x74, 0x65,
+  0x67, 0x65, 0x72, 0x73, 0x20, 0x6f, 0x66, 0x20, 0x6f, 0x74, 0x68, 0x65,
+  0x72, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x73, 0x2e, 0x20, 0x4f, 0x74,
+  0x68, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x73, 0x20, 0x67, 0x6f,
+  0x0a, 0x20, 0x20, 0x74, 0x68, 0x72, 0x6f, 0x75, 0x67, 0x68, 0x20, 0x21,
+  0x21, 0x2c, 0x20, 0x40, 0x40, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x2c, 0x2c,
+  0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x23, 0x20, 0x20, 0x20, 0x20, 0x30,
+  0x20, 0x23, 0x23, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3f, 0x20, 0x20, 0x40,
+  0x20, 0x2e, 0x20, 0x3b, 0x0a, 0x0a, 0x28, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x69, 0x6c, 0x65, 0x72, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x29,
+  0x0a, 0x0a, 0x3a, 0x20, 0x5b, 0x20, 0x30, 0x20, 0x63, 0x6f, 0x6d, 0x70,
+  0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x21, 0x20, 0x3b, 0x20, 0x69, 0x6d,
+  0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x5d, 0x20,
+  0x31, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20,
+  0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f,
+  0x6e, 0x65, 0x20, 0x31, 0x20, 0x5f, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f,
+  0x6e, 0x65, 0x20, 0x21, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64,
+  0x69, 0x61, 0x74, 0x65, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x73, 0x6f, 0x6d,
+  0x65, 0x20, 0x6f, 0x70, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x20,
+  0x61, 0x6e, 0x64, 0x20, 0x73, 0x68, 0x6f, 0x72, 0x74, 0x63, 0x75, 0x74,
+  0x73, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20,
+  0x31, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x32,
+  0x64, 0x72, 0x6f, 0x70, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x64, 0x72,
+  0x6f, 0x70, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6e, 0x69, 0x70, 0x20, 0x20,
+  0x73, 0x77, 0x61, 0x70, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x32, 0x6e, 0x69, 0x70, 0x20, 0x20, 0x32, 0x73, 0x77, 0x61,
+  0x70, 0x20, 0x32, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x3b, 0x0a, 0x3a, 0x20,
+  0x2b, 0x21, 0x20, 0x20, 0x20, 0x64, 0x75, 0x70, 0x20, 0x40, 0x20, 0x72,
+  0x6f, 0x74, 0x20, 0x2b, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x21, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x31, 0x2b, 0x20, 0x20, 0x20, 0x31, 0x20, 0x2b,
+  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x31, 0x2d, 0x20, 0x20, 0x20, 0x31, 0x20,
+  0x2d, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x69, 0x6e, 0x63, 0x20, 0x20, 0x31,
+  0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x2b, 0x21, 0x20, 0x3b, 0x0a, 0x3a,
+  0x20, 0x64, 0x65, 0x63, 0x20, 0x20, 0x2d, 0x31, 0x20, 0x73, 0x77, 0x61,
+  0x70, 0x20, 0x2b, 0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3c, 0x20, 0x20,
+  0x20, 0x20, 0x2d, 0x20, 0x3c, 0x30, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3e,
+  0x20, 0x20, 0x20, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x3c, 0x20, 0x3b,
+  0x0a, 0x3a, 0x20, 0x3c, 0x3d, 0x20, 0x20, 0x20, 0x6f, 0x76, 0x65, 0x72,
+  0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x3e, 0x72, 0x20, 0x3e, 0x72, 0x20,
+  0x3c, 0x20, 0x72, 0x3e, 0x20, 0x72, 0x3e, 0x20, 0x3d, 0x20, 0x2b, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x3e, 0x3d, 0x20, 0x20, 0x20, 0x73, 0x77, 0x61,
+  0x70, 0x20, 0x3c, 0x3d, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3d, 0x30, 0x20,
+  0x20, 0x20, 0x30, 0x20, 0x3d, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6e, 0x6f,
+  0x74, 0x20, 0x20, 0x3d, 0x30, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x21, 0x3d,
+  0x20, 0x20, 0x20, 0x3d, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x3b, 0x0a, 0x3a,
+  0x20, 0x63, 0x72, 0x20, 0x20, 0x20, 0x31, 0x30, 0x20, 0x65, 0x6d, 0x69,
+  0x74, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x70, 0x20, 0x20, 0x20, 0x33,
+  0x32, 0x20, 0x65, 0x6d, 0x69, 0x74, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x2e,
+  0x2e, 0x20, 0x20, 0x20, 0x64, 0x75, 0x70, 0x20, 0x2e, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x68, 0x20, 0x40, 0x20, 0x3b,
+  0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20,
+  0x6d, 0x61, 0x6e, 0x61, 0x67, 0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x29,
+  0x0a, 0x0a, 0x3a, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x20, 0x20, 0x68,
+  0x20, 0x2b, 0x21, 0x20, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x6c, 0x69,
+  0x67, 0x6e, 0x65, 0x64, 0x20, 0x31, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73,
+  0x20, 0x31, 0x2d, 0x20, 0x2b, 0x20, 0x64, 0x75, 0x70, 0x20, 0x31, 0x20,
+  0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x6d, 0x6f, 0x64, 0x20, 0x2d, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x20, 0x20, 0x68,
+  0x65, 0x72, 0x65, 0x20, 0x61, 0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x20,
+  0x68, 0x20, 0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x69,
+  0x61, 0x62, 0x6c, 0x65, 0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20,
+  0x31, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x6f,
+  0x74, 0x20, 0x3b, 0x0a, 0x0a, 0x28, 0x20, 0x62, 0x75, 0x6c, 0x6b, 0x20,
+  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x3a, 0x20, 0x66, 0x69, 0x6c, 0x6c,
+  0x20, 0x61, 0x6e, 0x64, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x2d, 0x66, 0x69,
+  0x6c, 0x6c, 0x20, 0x61, 0x72, 0x65, 0x20, 0x70, 0x72, 0x69, 0x6d, 0x69,
+  0x74, 0x69, 0x76, 0x65, 0x73, 0x2c, 0x20, 0x63, 0x6d, 0x6f, 0x76, 0x65,
+  0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x62, 0x79, 0x74, 0x65,
+  0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x0a, 0x20,
+  0x20, 0x63, 0x6f, 0x70, 0x69, 0x65, 0x73, 0x20, 0x63, 0x65, 0x6c, 0x6c,
+  0x73, 0x2c, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x6c, 0x61, 0x70, 0x70, 0x69,
+  0x6e, 0x67, 0x20, 0x6f, 0x72, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x29, 0x0a,
+  0x0a, 0x3a, 0x20, 0x65, 0x72, 0x61, 0x73, 0x65, 0x20, 0x20, 0x30, 0x20,
+  0x66, 0x69, 0x6c, 0x6c, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x62, 0x6c, 0x61,
+  0x6e, 0x6b, 0x20, 0x20, 0x33, 0x32, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x20, 0x20, 0x63,
+  0x65, 0x6c, 0x6c, 0x73, 0x20, 0x63, 0x6d, 0x6f, 0x76, 0x65, 0x20, 0x3b,
+  0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x27, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x27,
+  0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75,
+  0x72, 0x72, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73,
+  0x73, 0x2c, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x6f, 0x72,
+  0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c,
+  0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x69,
+  0x73, 0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x0a,
+  0x20, 0x20, 0x62, 0x79, 0x20, 0x27, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x27,
+  0x2c, 0x20, 0x27, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x27, 0x20, 0x6f, 0x72,
+  0x20, 0x27, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x27, 0x20, 0x29, 0x0a, 0x0a,
+  0x3a, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x20, 0x20, 0x20, 0x68, 0x65,
+  0x72, 0x65, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
+  0x74, 0x65, 0x0a, 0x3a, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x20,
+  0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x20, 0x2c, 0x76, 0x20,
+  0x2c, 0x76, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
+  0x74, 0x65, 0x0a, 0x3a, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x20,
+  0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x30, 0x20, 0x2c, 0x76,
+  0x20, 0x2c, 0x76, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69,
+  0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20,
+  0x5b, 0x27, 0x5d, 0x20, 0x31, 0x20, 0x2d, 0x20, 0x2c, 0x76, 0x20, 0x5b,
+  0x27, 0x5d, 0x20, 0x64, 0x75, 0x70, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27,
+  0x5d, 0x20, 0x3d, 0x30, 0x20, 0x2c, 0x76, 0x20, 0x70, 0x6f, 0x73, 0x74,
+  0x70, 0x6f, 0x6e, 0x65, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x3b,
+  0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x0a,
+  0x0a, 0x28, 0x20, 0x27, 0x69, 0x66, 0x27, 0x20, 0x70, 0x72, 0x65, 0x70,
+  0x61, 0x72, 0x65, 0x73, 0x20, 0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69,
+  0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x2c, 0x20, 0x61,
+  0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x77, 0x69, 0x6c, 0x6c, 0x20,
+  0x62, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x20, 0x62, 0x79, 0x20, 0x27, 0x65, 0x6c, 0x73, 0x65, 0x27, 0x20, 0x6f,
+  0x72, 0x20, 0x27, 0x66, 0x69, 0x27, 0x2e, 0x0a, 0x20, 0x20, 0x54, 0x68,
+  0x65, 0x20, 0x70, 0x6c, 0x61, 0x63, 0x65, 0x68, 0x6f, 0x6c, 0x64, 0x65,
+  0x72, 0x20, 0x31, 0x36, 0x33, 0x38, 0x34, 0x20, 0x69, 0x73, 0x20, 0x63,
+  0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x65, 0x64, 0x20, 0x61, 0x73, 0x20, 0x61,
+  0x20, 0x66, 0x69, 0x78, 0x65, 0x64, 0x20, 0x66, 0x6f, 0x75, 0x72, 0x20,
+  0x62, 0x79, 0x74, 0x65, 0x20, 0x69, 0x6e, 0x74, 0x65, 0x67, 0x65, 0x72,
+  0x2c, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x61, 0x6e, 0x79, 0x0a,
+  0x20, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x66, 0x69,
+  0x74, 0x73, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x3e, 0x6d, 0x61, 0x72,
+  0x6b, 0x20, 0x20, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x31, 0x36, 0x33,
+  0x38, 0x34, 0x20, 0x2c, 0x76, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x69, 0x66,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d,
+  0x70, 0x30, 0x20, 0x2c, 0x76, 0x20, 0x3e, 0x6d, 0x61, 0x72, 0x6b, 0x20,
   0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a,
-  0x0a, 0x0a, 0x28, 0x20, 0x73, 0x6f, 0x6d, 0x65, 0x20, 0x6f, 0x70, 0x65,
-  0x72, 0x61, 0x74, 0x6f, 0x72, 0x73, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x73,
-  0x68, 0x6f, 0x72, 0x74, 0x63, 0x75, 0x74, 0x73, 0x20, 0x29, 0x0a, 0x0a,
-  0x3a, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x31, 0x20, 0x70, 0x69, 0x63,
-  0x6b, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x32, 0x64, 0x72, 0x6f, 0x70, 0x20,
-  0x64, 0x72, 0x6f, 0x70, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x3b, 0x0a,
-  0x3a, 0x20, 0x6e, 0x69, 0x70, 0x20, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20,
-  0x64, 0x72, 0x6f, 0x70, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x32, 0x6e, 0x69,
-  0x70, 0x20, 0x20, 0x32, 0x73, 0x77, 0x61, 0x70, 0x20, 0x32, 0x64, 0x72,
-  0x6f, 0x70, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x2b, 0x21, 0x20, 0x20, 0x20,
-  0x64, 0x75, 0x70, 0x20, 0x40, 0x20, 0x72, 0x6f, 0x74, 0x20, 0x2b, 0x20,
-  0x73, 0x77, 0x61, 0x70, 0x20, 0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x31,
-  0x2b, 0x20, 0x20, 0x20, 0x31, 0x20, 0x2b, 0x20, 0x3b, 0x0a, 0x3a, 0x20,
-  0x31, 0x2d, 0x20, 0x20, 0x20, 0x31, 0x20, 0x2d, 0x20, 0x3b, 0x0a, 0x3a,
-  0x20, 0x69, 0x6e, 0x63, 0x20, 0x20, 0x31, 0x20, 0x73, 0x77, 0x61, 0x70,
-  0x20, 0x2b, 0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x64, 0x65, 0x63, 0x20,
-  0x20, 0x2d, 0x31, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x2b, 0x21, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x3c, 0x20, 0x20, 0x20, 0x20, 0x2d, 0x20, 0x3c,
-  0x30, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3e, 0x20, 0x20, 0x20, 0x20, 0x73,
-  0x77, 0x61, 0x70, 0x20, 0x3c, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3c, 0x3d,
-  0x20, 0x20, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x6f, 0x76, 0x65, 0x72,
-  0x20, 0x3e, 0x72, 0x20, 0x3e, 0x72, 0x20, 0x3c, 0x20, 0x72, 0x3e, 0x20,
-  0x72, 0x3e, 0x20, 0x3d, 0x20, 0x2b, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x3e,
-  0x3d, 0x20, 0x20, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x3c, 0x3d, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x3d, 0x30, 0x20, 0x20, 0x20, 0x30, 0x20, 0x3d,
-  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x20, 0x3d, 0x30,
-  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x21, 0x3d, 0x20, 0x20, 0x20, 0x3d, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x63, 0x72, 0x20, 0x20,
-  0x20, 0x31, 0x30, 0x20, 0x65, 0x6d, 0x69, 0x74, 0x20, 0x3b, 0x0a, 0x3a,
-  0x20, 0x73, 0x70, 0x20, 0x20, 0x20, 0x33, 0x32, 0x20, 0x65, 0x6d, 0x69,
-  0x74, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x2e, 0x2e, 0x20, 0x20, 0x20, 0x64,
-  0x75, 0x70, 0x20, 0x2e, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x68, 0x65, 0x72,
-  0x65, 0x20, 0x68, 0x20, 0x40, 0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x28, 0x20,
-  0x6d, 0x65, 0x6d, 0x6f, 0x72, 0x79, 0x20, 0x6d, 0x61, 0x6e, 0x61, 0x67,
-  0x65, 0x6d, 0x65, 0x6e, 0x74, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x61,
-  0x6c, 0x6c, 0x6f, 0x74, 0x20, 0x20, 0x68, 0x20, 0x2b, 0x21, 0x20, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x20, 0x31, 0x20, 0x63, 0x65,
-  0x6c, 0x6c, 0x73, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x20, 0x3b, 0x0a,
-  0x0a, 0x0a, 0x28, 0x20, 0x27, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x27, 0x20,
-  0x67, 0x65, 0x74, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x75, 0x72,
-  0x72, 0x65, 0x6e, 0x74, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73,
-  0x2c, 0x20, 0x61, 0x20, 0x6a, 0x75, 0x6d, 0x70, 0x20, 0x6f, 0x72, 0x20,
-  0x63, 0x6f, 0x6e, 0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20,
-  0x6a, 0x75, 0x6d, 0x70, 0x20, 0x62, 0x61, 0x63, 0x6b, 0x20, 0x69, 0x73,
-  0x20, 0x67, 0x65, 0x6e, 0x65, 0x72, 0x61, 0x74, 0x65, 0x64, 0x0a, 0x20,
-  0x20, 0x62, 0x79, 0x20, 0x27, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x27, 0x2c,
-  0x20, 0x27, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x27, 0x20, 0x6f, 0x72, 0x20,
-  0x27, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x27, 0x20, 0x29, 0x0a, 0x0a, 0x3a,
-  0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x20, 0x20, 0x20, 0x68, 0x65, 0x72,
-  0x65, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74,
-  0x65, 0x0a, 0x3a, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x20, 0x20,
-  0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x20, 0x2c, 0x20, 0x2c, 0x20,
-  0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a,
-  0x3a, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x20, 0x20, 0x5b, 0x27,
-  0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x30, 0x20, 0x2c, 0x20, 0x2c, 0x20, 0x3b,
-  0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a,
-  0x20, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x31,
-  0x20, 0x2d, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x64, 0x75, 0x70,
-  0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x3d, 0x30, 0x20, 0x2c, 0x20,
-  0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65, 0x20, 0x75, 0x6e, 0x74,
-  0x69, 0x6c, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
-  0x74, 0x65, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x27, 0x69, 0x66, 0x27, 0x20,
-  0x70, 0x72, 0x65, 0x70, 0x61, 0x72, 0x65, 0x73, 0x20, 0x63, 0x6f, 0x6e,
-  0x64, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x61, 0x6c, 0x20, 0x6a, 0x75, 0x6d,
-  0x70, 0x2c, 0x20, 0x61, 0x64, 0x64, 0x72, 0x65, 0x73, 0x73, 0x20, 0x77,
-  0x69, 0x6c, 0x6c, 0x20, 0x62, 0x65, 0x20, 0x66, 0x69, 0x6c, 0x6c, 0x65,
-  0x64, 0x20, 0x69, 0x6e, 0x20, 0x62, 0x79, 0x20, 0x27, 0x65, 0x6c, 0x73,
-  0x65, 0x27, 0x20, 0x6f, 0x72, 0x20, 0x27, 0x66, 0x69, 0x27, 0x20, 0x29,
-  0x0a, 0x0a, 0x3a, 0x20, 0x69, 0x66, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
-  0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x30, 0x20, 0x2c, 0x20, 0x68,
-  0x65, 0x72, 0x65, 0x20, 0x39, 0x39, 0x39, 0x20, 0x2c, 0x20, 0x3b, 0x20,
-  0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20,
-  0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x20, 0x5b, 0x27, 0x5d, 0x20,
-  0x6e, 0x6f, 0x74, 0x20, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f,
-  0x6e, 0x65, 0x20, 0x69, 0x66, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65,
-  0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x65, 0x6c, 0x73, 0x65,
-  0x20, 0x20, 0x20, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x20,
-  0x2c, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x39, 0x39, 0x39, 0x20, 0x2c,
-  0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73,
-  0x77, 0x61, 0x70, 0x20, 0x21, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65,
+  0x3a, 0x20, 0x75, 0x6e, 0x6c, 0x65, 0x73, 0x73, 0x20, 0x20, 0x5b, 0x27,
+  0x5d, 0x20, 0x6e, 0x6f, 0x74, 0x20, 0x2c, 0x76, 0x20, 0x70, 0x6f, 0x73,
+  0x74, 0x70, 0x6f, 0x6e, 0x65, 0x20, 0x69, 0x66, 0x20, 0x3b, 0x20, 0x69,
+  0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x65,
+  0x6c, 0x73, 0x65, 0x20, 0x20, 0x20, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6a,
+  0x6d, 0x70, 0x20, 0x2c, 0x76, 0x20, 0x3e, 0x6d, 0x61, 0x72, 0x6b, 0x20,
+  0x73, 0x77, 0x61, 0x70, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73, 0x77,
+  0x61, 0x70, 0x20, 0x21, 0x76, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65,
   0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x66, 0x69, 0x20, 0x20,
   0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x73, 0x77, 0x61,
-  0x70, 0x20, 0x21, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69,
-  0x61, 0x74, 0x65, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x66, 0x6f, 0x72, 0x74,
-  0x68, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x27, 0x64, 0x6f, 0x27,
-  0x20, 0x61, 0x6e, 0x64, 0x20, 0x27, 0x6c, 0x6f, 0x6f, 0x70, 0x27, 0x2c,
-  0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20, 0x6c,
-  0x6f, 0x6f, 0x70, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f, 0x72,
-  0x73, 0x20, 0x27, 0x69, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x27, 0x6a,
-  0x27, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x69, 0x20, 0x5b, 0x27, 0x5d,
-  0x20, 0x6c, 0x69, 0x74, 0x20, 0x2c, 0x20, 0x30, 0x20, 0x2c, 0x20, 0x5b,
-  0x27, 0x5d, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x72, 0x20, 0x2c, 0x20, 0x3b,
-  0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a,
-  0x20, 0x6a, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c, 0x69, 0x74, 0x20, 0x2c,
-  0x20, 0x32, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x70, 0x69, 0x63,
-  0x6b, 0x72, 0x20, 0x2c, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64,
-  0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x64, 0x6f, 0x20, 0x5b, 0x27,
-  0x5d, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d,
-  0x20, 0x3e, 0x72, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x3e, 0x72,
-  0x20, 0x2c, 0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x3b, 0x20, 0x69, 0x6d,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x6c, 0x6f,
-  0x6f, 0x70, 0x2b, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x72, 0x3e, 0x20, 0x2c,
-  0x20, 0x5b, 0x27, 0x5d, 0x20, 0x2b, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d,
-  0x20, 0x64, 0x75, 0x70, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x3e,
-  0x72, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c, 0x69, 0x74, 0x20,
-  0x2c, 0x20, 0x31, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x70, 0x69,
-  0x63, 0x6b, 0x72, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x3e, 0x20,
-  0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6a, 0x6d, 0x70, 0x30, 0x20, 0x2c,
-  0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x72, 0x3e, 0x20, 0x2c, 0x20,
-  0x5b, 0x27, 0x5d, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x2c, 0x20, 0x5b,
-  0x27, 0x5d, 0x20, 0x72, 0x3e, 0x20, 0x2c, 0x20, 0x5b, 0x27, 0x5d, 0x20,
-  0x64, 0x72, 0x6f, 0x70, 0x20, 0x2c, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d,
+  0x70, 0x20, 0x21, 0x76, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64,
+  0x69, 0x61, 0x74, 0x65, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x66, 0x6f, 0x72,
+  0x74, 0x68, 0x20, 0x73, 0x74, 0x79, 0x6c, 0x65, 0x20, 0x27, 0x64, 0x6f,
+  0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x27, 0x6c, 0x6f, 0x6f, 0x70, 0x27,
+  0x2c, 0x20, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x69, 0x6e, 0x67, 0x20,
+  0x6c, 0x6f, 0x6f, 0x70, 0x20, 0x69, 0x74, 0x65, 0x72, 0x61, 0x74, 0x6f,
+  0x72, 0x73, 0x20, 0x27, 0x69, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20, 0x27,
+  0x6a, 0x27, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x69, 0x20, 0x5b, 0x27,
+  0x5d, 0x20, 0x6c, 0x69, 0x74, 0x20, 0x2c, 0x76, 0x20, 0x30, 0x20, 0x2c,
+  0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x72, 0x20,
+  0x2c, 0x76, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61,
+  0x74, 0x65, 0x0a, 0x3a, 0x20, 0x6a, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c,
+  0x69, 0x74, 0x20, 0x2c, 0x76, 0x20, 0x32, 0x20, 0x2c, 0x76, 0x20, 0x5b,
+  0x27, 0x5d, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x72, 0x20, 0x2c, 0x76, 0x20,
+  0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a,
+  0x3a, 0x20, 0x64, 0x6f, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x73, 0x77, 0x61,
+  0x70, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x3e, 0x72, 0x20,
+  0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x3e, 0x72, 0x20, 0x2c, 0x76,
+  0x20, 0x68, 0x65, 0x72, 0x65, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65,
+  0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x6c, 0x6f, 0x6f, 0x70,
+  0x2b, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x72, 0x3e, 0x20, 0x2c, 0x76, 0x20,
+  0x5b, 0x27, 0x5d, 0x20, 0x2b, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d,
+  0x20, 0x64, 0x75, 0x70, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20,
+  0x3e, 0x72, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c, 0x69,
+  0x74, 0x20, 0x2c, 0x76, 0x20, 0x31, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27,
+  0x5d, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x72, 0x20, 0x2c, 0x76, 0x20, 0x5b,
+  0x27, 0x5d, 0x20, 0x3e, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20,
+  0x6a, 0x6d, 0x70, 0x30, 0x20, 0x2c, 0x76, 0x20, 0x2c, 0x76, 0x20, 0x5b,
+  0x27, 0x5d, 0x20, 0x72, 0x3e, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d,
+  0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d,
+  0x20, 0x72, 0x3e, 0x20, 0x2c, 0x76, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x64,
+  0x72, 0x6f, 0x70, 0x20, 0x2c, 0x76, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d,
   0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x6c, 0x6f, 0x6f,
-  0x70, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c, 0x69, 0x74, 0x20, 0x2c, 0x20,
-  0x31, 0x20, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65,
-  0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x2b, 0x20, 0x3b, 0x20, 0x20, 0x69, 0x6d,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x0a, 0x28, 0x20, 0x73,
-  0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x5b,
-  0x63, 0x68, 0x61, 0x72, 0x5d, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c, 0x69,
-  0x74, 0x20, 0x2c, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65,
-  0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2c, 0x20, 0x3b, 0x20, 0x69, 0x6d,
-  0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x2e, 0x22,
-  0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65, 0x20, 0x73, 0x22,
-  0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x40,
-  0x20, 0x69, 0x66, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x74, 0x79, 0x70, 0x65,
-  0x20, 0x2c, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x74, 0x79, 0x70, 0x65,
-  0x20, 0x66, 0x69, 0x20, 0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69,
-  0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x62, 0x6f, 0x75, 0x6e, 0x64, 0x73,
-  0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x2b, 0x20, 0x3b, 0x0a, 0x3a, 0x20,
-  0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x20, 0x28, 0x20, 0x73, 0x74, 0x72,
-  0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d, 0x2d, 0x20, 0x61, 0x64, 0x64,
-  0x72, 0x20, 0x29, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x20, 0x61, 0x63,
-  0x63, 0x65, 0x70, 0x74, 0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x31,
-  0x30, 0x30, 0x20, 0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x73,
-  0x20, 0x29, 0x0a, 0x0a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
-  0x20, 0x72, 0x65, 0x67, 0x73, 0x20, 0x31, 0x30, 0x30, 0x20, 0x38, 0x20,
-  0x2a, 0x20, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0a, 0x3a, 0x20, 0x72, 0x63,
-  0x6c, 0x20, 0x64, 0x75, 0x70, 0x20, 0x39, 0x39, 0x20, 0x3e, 0x20, 0x69,
-  0x66, 0x20, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x69, 0x20, 0x63,
-  0x65, 0x6c, 0x6c, 0x73, 0x20, 0x72, 0x65, 0x67, 0x73, 0x20, 0x2b, 0x20,
-  0x40, 0x63, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x74, 0x6f, 0x20, 0x64,
-  0x75, 0x70, 0x20, 0x39, 0x39, 0x20, 0x3e, 0x20, 0x69, 0x66, 0x20, 0x61,
-  0x62, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x69, 0x20, 0x63, 0x65, 0x6c, 0x6c,
-  0x73, 0x20, 0x72, 0x65, 0x67, 0x73, 0x20, 0x2b, 0x20, 0x21, 0x63, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x74, 0x6f, 0x2b, 0x20, 0x64, 0x75, 0x70,
-  0x20, 0x72, 0x63, 0x6c, 0x20, 0x72, 0x6f, 0x74, 0x20, 0x2b, 0x20, 0x73,
-  0x77, 0x61, 0x70, 0x20, 0x73, 0x74, 0x6f, 0x20, 0x3b, 0x0a, 0x3a, 0x20,
-  0x73, 0x74, 0x6f, 0x2d, 0x20, 0x64, 0x75, 0x70, 0x20, 0x72, 0x63, 0x6c,
+  0x70, 0x20, 0x5b, 0x27, 0x5d, 0x20, 0x6c, 0x69, 0x74, 0x20, 0x2c, 0x76,
+  0x20, 0x31, 0x20, 0x2c, 0x76, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f,
+  0x6e, 0x65, 0x20, 0x6c, 0x6f, 0x6f, 0x70, 0x2b, 0x20, 0x3b, 0x20, 0x20,
+  0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x0a, 0x28,
+  0x20, 0x73, 0x74, 0x72, 0x69, 0x6e, 0x67, 0x20, 0x29, 0x0a, 0x0a, 0x3a,
+  0x20, 0x5b, 0x63, 0x68, 0x61, 0x72, 0x5d, 0x20, 0x5b, 0x27, 0x5d, 0x20,
+  0x6c, 0x69, 0x74, 0x20, 0x2c, 0x76, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70,
+  0x6f, 0x6e, 0x65, 0x20, 0x63, 0x68, 0x61, 0x72, 0x20, 0x2c, 0x76, 0x20,
+  0x3b, 0x20, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a,
+  0x3a, 0x20, 0x2e, 0x22, 0x20, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e,
+  0x65, 0x20, 0x73, 0x22, 0x20, 0x63, 0x6f, 0x6d, 0x70, 0x69, 0x6c, 0x69,
+  0x6e, 0x67, 0x20, 0x40, 0x20, 0x69, 0x66, 0x20, 0x5b, 0x27, 0x5d, 0x20,
+  0x74, 0x79, 0x70, 0x65, 0x20, 0x2c, 0x76, 0x20, 0x65, 0x6c, 0x73, 0x65,
+  0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x66, 0x69, 0x20, 0x3b, 0x20, 0x69,
+  0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x0a, 0x3a, 0x20, 0x62,
+  0x6f, 0x75, 0x6e, 0x64, 0x73, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x2b,
+  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x20,
+  0x28, 0x20, 0x73, 0x74, 0x72, 0x20, 0x73, 0x69, 0x7a, 0x65, 0x20, 0x2d,
+  0x2d, 0x20, 0x61, 0x64, 0x64, 0x72, 0x20, 0x29, 0x20, 0x61, 0x6c, 0x6c,
+  0x6f, 0x63, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x20, 0x3b, 0x0a,
+  0x0a, 0x0a, 0x28, 0x20, 0x61, 0x72, 0x72, 0x61, 0x79, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x3a, 0x20, 0x27, 0x6d, 0x61,
+  0x70, 0x27, 0x20, 0x73, 0x74, 0x6f, 0x72, 0x65, 0x73, 0x20, 0x78, 0x74,
+  0x20, 0x61, 0x70, 0x70, 0x6c, 0x69, 0x65, 0x64, 0x20, 0x74, 0x6f, 0x20,
+  0x65, 0x61, 0x63, 0x68, 0x20, 0x6f, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20,
+  0x6e, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x61, 0x74, 0x20, 0x73,
+  0x72, 0x63, 0x20, 0x69, 0x6e, 0x0a, 0x20, 0x20, 0x64, 0x73, 0x74, 0x2c,
+  0x20, 0x27, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x27, 0x20, 0x66, 0x6f,
+  0x6c, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6e, 0x20, 0x63, 0x65,
+  0x6c, 0x6c, 0x73, 0x20, 0x61, 0x74, 0x20, 0x73, 0x72, 0x63, 0x20, 0x69,
+  0x6e, 0x74, 0x6f, 0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x77, 0x69, 0x74,
+  0x68, 0x20, 0x78, 0x74, 0x2e, 0x20, 0x27, 0x70, 0x6d, 0x61, 0x70, 0x27,
+  0x20, 0x61, 0x6e, 0x64, 0x0a, 0x20, 0x20, 0x27, 0x70, 0x72, 0x65, 0x64,
+  0x75, 0x63, 0x65, 0x27, 0x20, 0x61, 0x72, 0x65, 0x20, 0x74, 0x68, 0x65,
+  0x20, 0x73, 0x61, 0x6d, 0x65, 0x2c, 0x20, 0x72, 0x75, 0x6e, 0x20, 0x69,
+  0x6e, 0x20, 0x70, 0x61, 0x72, 0x61, 0x6c, 0x6c, 0x65, 0x6c, 0x20, 0x62,
+  0x79, 0x20, 0x68, 0x6f, 0x73, 0x74, 0x73, 0x20, 0x77, 0x68, 0x69, 0x63,
+  0x68, 0x20, 0x63, 0x61, 0x6e, 0x2c, 0x20, 0x69, 0x6e, 0x20, 0x77, 0x68,
+  0x69, 0x63, 0x68, 0x20, 0x63, 0x61, 0x73, 0x65, 0x0a, 0x20, 0x20, 0x74,
+  0x68, 0x65, 0x20, 0x78, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x70, 0x72, 0x65,
+  0x64, 0x75, 0x63, 0x65, 0x20, 0x6d, 0x75, 0x73, 0x74, 0x20, 0x62, 0x65,
+  0x20, 0x61, 0x73, 0x73, 0x6f, 0x63, 0x69, 0x61, 0x74, 0x69, 0x76, 0x65,
+  0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x6d, 0x61, 0x70, 0x20, 0x28, 0x20,
+  0x78, 0x74, 0x20, 0x73, 0x72, 0x63, 0x20, 0x64, 0x73, 0x74, 0x20, 0x6e,
+  0x20, 0x2d, 0x2d, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x67, 0x69,
+  0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x75, 0x70, 0x20, 0x3d, 0x30,
+  0x20, 0x69, 0x66, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x64, 0x72, 0x6f,
+  0x70, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20,
+  0x65, 0x78, 0x69, 0x74, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x3e, 0x72, 0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x40, 0x20, 0x33, 0x20,
+  0x70, 0x69, 0x63, 0x6b, 0x20, 0x65, 0x78, 0x65, 0x63, 0x75, 0x74, 0x65,
+  0x20, 0x6f, 0x76, 0x65, 0x72, 0x20, 0x21, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x73, 0x77, 0x61, 0x70, 0x20, 0x31, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73,
+  0x20, 0x2b, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x31, 0x20, 0x63, 0x65,
+  0x6c, 0x6c, 0x73, 0x20, 0x2b, 0x20, 0x72, 0x3e, 0x20, 0x31, 0x2d, 0x0a,
+  0x20, 0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x3b, 0x0a, 0x0a, 0x3a,
+  0x20, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x28, 0x20, 0x78, 0x74,
+  0x20, 0x69, 0x6e, 0x69, 0x74, 0x20, 0x73, 0x72, 0x63, 0x20, 0x6e, 0x20,
+  0x2d, 0x2d, 0x20, 0x72, 0x20, 0x29, 0x0a, 0x20, 0x20, 0x62, 0x65, 0x67,
+  0x69, 0x6e, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x64, 0x75, 0x70, 0x20, 0x3d,
+  0x30, 0x20, 0x69, 0x66, 0x20, 0x64, 0x72, 0x6f, 0x70, 0x20, 0x64, 0x72,
+  0x6f, 0x70, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x64, 0x72, 0x6f, 0x70,
+  0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x66, 0x69, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x3e, 0x72, 0x20, 0x64, 0x75, 0x70, 0x20, 0x3e, 0x72, 0x20, 0x40,
+  0x20, 0x32, 0x20, 0x70, 0x69, 0x63, 0x6b, 0x20, 0x65, 0x78, 0x65, 0x63,
+  0x75, 0x74, 0x65, 0x20, 0x72, 0x3e, 0x20, 0x31, 0x20, 0x63, 0x65, 0x6c,
+  0x6c, 0x73, 0x20, 0x2b, 0x20, 0x72, 0x3e, 0x20, 0x31, 0x2d, 0x0a, 0x20,
+  0x20, 0x61, 0x67, 0x61, 0x69, 0x6e, 0x20, 0x3b, 0x0a, 0x0a, 0x3a, 0x20,
+  0x70, 0x6d, 0x61, 0x70, 0x20, 0x20, 0x20, 0x20, 0x6d, 0x61, 0x70, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x70, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20,
+  0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x28,
+  0x20, 0x74, 0x61, 0x73, 0x6b, 0x73, 0x3a, 0x20, 0x27, 0x32, 0x35, 0x36,
+  0x20, 0x74, 0x61, 0x73, 0x6b, 0x27, 0x20, 0x6d, 0x61, 0x6b, 0x65, 0x73,
+  0x20, 0x61, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x20, 0x77, 0x69, 0x74, 0x68,
+  0x20, 0x32, 0x35, 0x36, 0x20, 0x62, 0x79, 0x74, 0x65, 0x73, 0x20, 0x6f,
+  0x66, 0x20, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x73, 0x2c, 0x20, 0x61, 0x6e,
+  0x64, 0x20, 0x61, 0x20, 0x77, 0x6f, 0x72, 0x64, 0x0a, 0x20, 0x20, 0x63,
+  0x61, 0x6c, 0x6c, 0x69, 0x6e, 0x67, 0x20, 0x27, 0x61, 0x63, 0x74, 0x69,
+  0x76, 0x61, 0x74, 0x65, 0x27, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x69,
+  0x74, 0x20, 0x72, 0x75, 0x6e, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72,
+  0x65, 0x73, 0x74, 0x20, 0x6f, 0x66, 0x20, 0x69, 0x74, 0x73, 0x20, 0x64,
+  0x65, 0x66, 0x69, 0x6e, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x69, 0x6e,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x74, 0x61, 0x73, 0x6b, 0x2e, 0x0a, 0x20,
+  0x20, 0x27, 0x70, 0x61, 0x75, 0x73, 0x65, 0x27, 0x20, 0x6c, 0x65, 0x74,
+  0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6f, 0x74, 0x68, 0x65, 0x72, 0x20,
+  0x74, 0x61, 0x73, 0x6b, 0x73, 0x20, 0x72, 0x75, 0x6e, 0x2c, 0x20, 0x61,
+  0x6e, 0x64, 0x20, 0x73, 0x6f, 0x20, 0x64, 0x6f, 0x20, 0x27, 0x73, 0x6c,
+  0x65, 0x65, 0x70, 0x2d, 0x6d, 0x73, 0x27, 0x20, 0x61, 0x6e, 0x64, 0x20,
+  0x27, 0x6b, 0x65, 0x79, 0x27, 0x20, 0x77, 0x68, 0x69, 0x6c, 0x65, 0x0a,
+  0x20, 0x20, 0x74, 0x68, 0x65, 0x79, 0x20, 0x77, 0x61, 0x69, 0x74, 0x2e,
+  0x20, 0x27, 0x73, 0x74, 0x6f, 0x70, 0x27, 0x20, 0x65, 0x6e, 0x64, 0x73,
+  0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x75, 0x6e, 0x6e, 0x69, 0x6e, 0x67,
+  0x20, 0x74, 0x61, 0x73, 0x6b, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x73,
+  0x6c, 0x65, 0x65, 0x70, 0x2d, 0x6d, 0x73, 0x20, 0x28, 0x20, 0x6d, 0x73,
+  0x20, 0x2d, 0x2d, 0x20, 0x29, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x20,
+  0x2b, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e, 0x20, 0x70, 0x61, 0x75, 0x73,
+  0x65, 0x20, 0x64, 0x75, 0x70, 0x20, 0x74, 0x69, 0x63, 0x6b, 0x73, 0x20,
+  0x3c, 0x3d, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x64, 0x72, 0x6f,
+  0x70, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6b, 0x65, 0x79, 0x20, 0x28, 0x20,
+  0x2d, 0x2d, 0x20, 0x63, 0x20, 0x29, 0x20, 0x62, 0x65, 0x67, 0x69, 0x6e,
+  0x20, 0x6b, 0x65, 0x79, 0x3f, 0x20, 0x64, 0x75, 0x70, 0x20, 0x75, 0x6e,
+  0x6c, 0x65, 0x73, 0x73, 0x20, 0x70, 0x61, 0x75, 0x73, 0x65, 0x20, 0x66,
+  0x69, 0x20, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x20, 0x33, 0x20, 0x73, 0x79,
+  0x73, 0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x28, 0x20, 0x31, 0x30, 0x30, 0x20,
+  0x72, 0x65, 0x67, 0x69, 0x73, 0x74, 0x65, 0x72, 0x73, 0x20, 0x29, 0x0a,
+  0x0a, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65, 0x20, 0x72, 0x65,
+  0x67, 0x73, 0x20, 0x39, 0x39, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20,
+  0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x0a, 0x3a, 0x20, 0x72, 0x63, 0x6c, 0x20,
+  0x64, 0x75, 0x70, 0x20, 0x39, 0x39, 0x20, 0x3e, 0x20, 0x69, 0x66, 0x20,
+  0x61, 0x62, 0x6f, 0x72, 0x74, 0x20, 0x66, 0x69, 0x20, 0x63, 0x65, 0x6c,
+  0x6c, 0x73, 0x20, 0x72, 0x65, 0x67, 0x73, 0x20, 0x2b, 0x20, 0x40, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x74, 0x6f, 0x20, 0x64, 0x75, 0x70, 0x20,
+  0x39, 0x39, 0x20, 0x3e, 0x20, 0x69, 0x66, 0x20, 0x61, 0x62, 0x6f, 0x72,
+  0x74, 0x20, 0x66, 0x69, 0x20, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x20, 0x72,
+  0x65, 0x67, 0x73, 0x20, 0x2b, 0x20, 0x21, 0x20, 0x3b, 0x0a, 0x3a, 0x20,
+  0x73, 0x74, 0x6f, 0x2b, 0x20, 0x64, 0x75, 0x70, 0x20, 0x72, 0x63, 0x6c,
   0x20, 0x72, 0x6f, 0x74, 0x20, 0x2b, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20,
-  0x73, 0x74, 0x6f, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x74, 0x6f, 0x2a,
+  0x73, 0x74, 0x6f, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x74, 0x6f, 0x2d,
   0x20, 0x64, 0x75, 0x70, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x72, 0x6f, 0x74,
-  0x20, 0x2a, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x73, 0x74, 0x6f, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x72, 0x63, 0x6c, 0x2b, 0x20, 0x72, 0x63, 0x6c,
-  0x20, 0x2b, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x72, 0x63, 0x6c, 0x2d, 0x20,
-  0x72, 0x63, 0x6c, 0x20, 0x2d, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x72, 0x63,
-  0x6c, 0x2a, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x2a, 0x20, 0x3b, 0x0a, 0x0a,
-  0x0a, 0x0a, 0x28, 0x20, 0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x63,
-  0x61, 0x6c, 0x6c, 0x73, 0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x73, 0x69,
-  0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x30, 0x20, 0x73, 0x79,
-  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x63, 0x6f, 0x73, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x31, 0x34, 0x31, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
-  0x3a, 0x20, 0x74, 0x61, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34,
-  0x32, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x73,
-  0x69, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x33, 0x20, 0x73, 0x79,
-  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x63, 0x6f, 0x73, 0x20, 0x20,
-  0x20, 0x20, 0x31, 0x34, 0x34, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
-  0x3a, 0x20, 0x61, 0x74, 0x61, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34,
-  0x35, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x71,
-  0x72, 0x74, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x36, 0x20, 0x73, 0x79,
-  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x70, 0x6f, 0x77, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x31, 0x34, 0x37, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
-  0x3a, 0x20, 0x6c, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34,
-  0x38, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6c, 0x6f,
-  0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x39, 0x20, 0x73, 0x79,
-  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x65, 0x78, 0x70, 0x20, 0x20, 0x20,
-  0x20, 0x20, 0x31, 0x35, 0x30, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
-  0x3a, 0x20, 0x61, 0x62, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x35,
-  0x31, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6e, 0x65,
-  0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x35, 0x32, 0x20, 0x73, 0x79,
-  0x73, 0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x3a, 0x20, 0x70, 0x69, 0x20, 0x33,
-  0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32, 0x36, 0x35, 0x33, 0x35, 0x38,
-  0x39, 0x37, 0x39, 0x33, 0x20, 0x3b, 0x0a, 0x0a, 0x3a, 0x20, 0x25, 0x20,
-  0x31, 0x30, 0x30, 0x20, 0x2f, 0x20, 0x2a, 0x20, 0x3b, 0x0a, 0x0a, 0x3a,
-  0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x20, 0x20, 0x32, 0x30,
-  0x30, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x63, 0x6c,
-  0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x31, 0x20, 0x73,
-  0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x6c, 0x65, 0x72, 0x74,
-  0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x32, 0x20, 0x73, 0x79, 0x73, 0x20,
-  0x3b, 0x0a, 0x3a, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20,
-  0x20, 0x32, 0x30, 0x33, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a,
-  0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x20, 0x20, 0x32, 0x30,
-  0x34, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x65,
-  0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x20, 0x32, 0x30, 0x35, 0x20, 0x73,
-  0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x65, 0x74, 0x78, 0x79,
-  0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x36, 0x20, 0x73, 0x79, 0x73, 0x20,
-  0x3b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a
+  0x20, 0x2b, 0x20, 0x73, 0x77, 0x61, 0x70, 0x20, 0x73, 0x74, 0x6f, 0x20,
+  0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x74, 0x6f, 0x2a, 0x20, 0x64, 0x75, 0x70,
+  0x20, 0x72, 0x63, 0x6c, 0x20, 0x72, 0x6f, 0x74, 0x20, 0x2a, 0x20, 0x73,
+  0x77, 0x61, 0x70, 0x20, 0x73, 0x74, 0x6f, 0x20, 0x3b, 0x0a, 0x3a, 0x20,
+  0x72, 0x63, 0x6c, 0x2b, 0x20, 0x72, 0x63, 0x6c, 0x20, 0x2b, 0x20, 0x3b,
+  0x0a, 0x3a, 0x20, 0x72, 0x63, 0x6c, 0x2d, 0x20, 0x72, 0x63, 0x6c, 0x20,
+  0x2d, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x72, 0x63, 0x6c, 0x2a, 0x20, 0x72,
+  0x63, 0x6c, 0x20, 0x2a, 0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x0a, 0x28, 0x20,
+  0x73, 0x79, 0x73, 0x74, 0x65, 0x6d, 0x20, 0x63, 0x61, 0x6c, 0x6c, 0x73,
+  0x20, 0x29, 0x0a, 0x0a, 0x3a, 0x20, 0x73, 0x69, 0x6e, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x34, 0x30, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x63, 0x6f, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34,
+  0x31, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x74, 0x61,
+  0x6e, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x32, 0x20, 0x73, 0x79,
+  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x73, 0x69, 0x6e, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x34, 0x33, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x61, 0x63, 0x6f, 0x73, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34,
+  0x34, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x74,
+  0x61, 0x6e, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x35, 0x20, 0x73, 0x79,
+  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x71, 0x72, 0x74, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x34, 0x36, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x70, 0x6f, 0x77, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34,
+  0x37, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6c, 0x6e,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x34, 0x38, 0x20, 0x73, 0x79,
+  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6c, 0x6f, 0x67, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x34, 0x39, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x65, 0x78, 0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x35,
+  0x30, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x62,
+  0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x35, 0x31, 0x20, 0x73, 0x79,
+  0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6e, 0x65, 0x67, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x31, 0x35, 0x32, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
+  0x0a, 0x0a, 0x33, 0x2e, 0x31, 0x34, 0x31, 0x35, 0x39, 0x32, 0x36, 0x35,
+  0x33, 0x35, 0x38, 0x39, 0x37, 0x39, 0x33, 0x20, 0x63, 0x6f, 0x6e, 0x73,
+  0x74, 0x61, 0x6e, 0x74, 0x20, 0x70, 0x69, 0x0a, 0x0a, 0x3a, 0x20, 0x25,
+  0x20, 0x31, 0x30, 0x30, 0x20, 0x2f, 0x20, 0x2a, 0x20, 0x3b, 0x0a, 0x0a,
+  0x3a, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x20, 0x20, 0x32,
+  0x30, 0x30, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x63,
+  0x6c, 0x73, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x31, 0x20,
+  0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x61, 0x6c, 0x65, 0x72,
+  0x74, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x32, 0x20, 0x73, 0x79, 0x73,
+  0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65,
+  0x20, 0x20, 0x32, 0x30, 0x33, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a,
+  0x3a, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x20, 0x20, 0x32,
+  0x30, 0x34, 0x20, 0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73,
+  0x65, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x20, 0x20, 0x32, 0x30, 0x35, 0x20,
+  0x73, 0x79, 0x73, 0x20, 0x3b, 0x0a, 0x3a, 0x20, 0x73, 0x65, 0x74, 0x78,
+  0x79, 0x20, 0x20, 0x20, 0x20, 0x32, 0x30, 0x36, 0x20, 0x73, 0x79, 0x73,
+  0x20, 0x3b, 0x0a, 0x0a, 0x0a, 0x0a, 0x0a
 };
-unsigned int all_zf_len = 3006;
+unsigned int all_zf_len = 4627;
@@ -22,9 +22,10 @@
 #define ZF_ENABLE_BOOTSTRAP 1
 
 /* Set to 1 to enable typed access to memory. This allows memory read and write 
- * of signed and unsigned memory of 8, 16 and 32 bits width, as well as the zf_cell 
- * type. This adds a few hundred bytes of .text. Check the memaccess.zf file for
- * examples how to use these operations */
+ * of signed and unsigned memory of 8, 16 and 32 bits width. Access to whole
+ * zf_cells, used by @ and !, is always available. This adds a few hundred bytes
+ * of .text. Check the memaccess.zf file for examples how to use these
+ * operations */
 
 #define ZF_ENABLE_TYPED_MEM_ACCESS 1
 
@@ -41,11 +42,49 @@ typedef double zf_cell;
 typedef unsigned int zf_addr;
 #define ZF_ADDR_FMT "%04x"
 
-/* Memory region sizes: dictionary size is given in bytes, stack sizes are
- * number of elements of type zf_cell */
+/* Memory region sizes in bytes. The data and return stacks share the stack
+ * region. With ZF_ENABLE_DYNAMIC_MEM these are the defaults used when
+ * zf_init() is given a size of 0 */
 
 #define ZF_DICT_SIZE 32 * 1024
 #define ZF_STACK_SIZE 16 * 1024
 #define ZF_PAD_SIZE 16 * 1024
 
+/* Size of the data space for large arrays, allocated with 'xallot' at
+ * addresses above the dictionary, PAD and stacks. The default, 0, costs
+ * nothing */
+
+#define ZF_DATA_SIZE 0
+
+/* Block storage: the number of block buffers kept in memory, at least 1, and
+ * the size of a block in bytes. The buffers follow the data space, and blocks
+ * are read and written by the host with zf_host_block_read() and
+ * zf_host_block_write() */
+
+#define ZF_BLOCK_BUFFERS 4
+#define ZF_BLOCK_SIZE 1024
+
+/* Number of entries in the literal pool, at most 61. Literals which do not
+ * fit in two bytes are kept in this table at the start of the dictionary, so
+ * that code using them takes one byte per use. Costs a cell per entry */
+
+#define ZF_LIT_POOL_SIZE 32
+
+/* Set to 1 to choose the region sizes at run time with zf_init(). The memory
+ * is then reserved as address space with mmap(), and the system commits the
+ * pages as they are touched, so a dictionary of hundreds of MB only costs
+ * what is used. Requires a POSIX host. With 0 the sizes are constants and the
+ * memory is one malloc()ed block */
+
+#ifndef ZF_ENABLE_DYNAMIC_MEM
+#define ZF_ENABLE_DYNAMIC_MEM 0
+#endif
+
+/* Storage class of the pointer to the current context. Define as
+ * _Thread_local to let several threads each run their own context */
+
+#ifndef ZF_THREAD_LOCAL
+#define ZF_THREAD_LOCAL
+#endif
+
 #endif
@@ -7,16 +7,121 @@
 
 #include "zforth.h"
 
-#define ZF_MEMORY_SIZE (ZF_DICT_SIZE + ZF_STACK_SIZE + ZF_PAD_SIZE)
-#define ZF_DSTACK (ZF_MEMORY_SIZE - ZF_STACK_SIZE)
-#define ZF_RSTACK (ZF_MEMORY_SIZE - sizeof(zf_cell))
-#define ZF_PAD ZF_DICT_SIZE
+#if ZF_ENABLE_DYNAMIC_MEM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+/* Block buffer, see block_get() */
+
+typedef struct
+{
+    unsigned int blk;
+    uint32_t used; /* tick of the last access, 0 if the buffer is empty */
+    bool dirty;
+} block_buf;
+
+/* A task: saved registers and stack bottoms, see 'task'. The interpreter
+ * itself is task 0, kept in the context */
+
+typedef struct
+{
+    zf_addr next;  /* next task in the round-robin ring */
+    zf_addr state; /* TASK_STOPPED or TASK_READY */
+    zf_addr ip;
+    zf_addr dsp;
+    zf_addr rsp;
+    zf_addr s0; /* data stack bottom */
+    zf_addr r0; /* return stack bottom */
+    zf_addr handler; /* innermost catch frame */
+} zf_task;
+
+/* All interpreter state is kept in a context, so that a process can run
+ * several interpreters. 'ctx' is the context the calling thread works on, see
+ * zf_ctx_select() */
+
+struct zf_ctx
+{
+    uint8_t *mem;    /* dictionary, PAD, stacks, data space and block buffers */
+    bool mem_mapped; /* mem is provided by the host, see zf_image_map() */
+    zf_addr *uservar;
+#if ZF_ENABLE_DYNAMIC_MEM
+    zf_addr dict_size, pad_size, stack_size, data_size;
+    int shared_fd; /* file holding the shared dictionary, see zf_ctx_share() */
+#endif
+    zf_addr shared_len; /* length of the shared dictionary, 0 if none */
+    zf_input_state input_state;
+    zf_addr ip;
+    jmp_buf *jmp;     /* setjmp env for handling aborts, see eval() and zf_call() */
+    short run_depth;  /* nesting of run() calls */
+    short eval_depth; /* nesting of zf_eval() calls */
+    char word[32];    /* word being read by handle_char() */
+    size_t word_len;
+    zf_addr tick_here; /* HERE after compiling ['], its operand is a plain xt */
+    zf_addr prim_op, prim_xt; /* last primitive looked up by word_xt() */
+    bool compact_pending; /* set by 'compact', the dictionary is compacted when zf_eval() returns */
+    bool txn_open;        /* compile transaction, see txn_begin() */
+    zf_addr txn_here, txn_latest;
+    zf_cell txn_pool;
+    zf_addr data_here; /* next free address of the data space */
+    block_buf block_bufs[ZF_BLOCK_BUFFERS];
+    uint32_t block_tick;
+    int block_cur; /* buffer of the last 'block' or 'buffer', for 'update' */
+    zf_addr task;     /* running task, 0 for the interpreter */
+    zf_addr s0, r0;   /* stack bottoms of the running task */
+    zf_task task0;    /* the interpreter, while another task runs */
+    zf_addr handler;  /* innermost catch frame on the return stack, 0 if none */
+    zf_cell thrown;   /* code of the last ZF_ABORT_THROW */
+    uint32_t budget;     /* instructions left before budget_out() */
+    bool slicing;        /* evaluation started by zf_eval_slice() */
+    bool suspended;      /* ... and waiting for zf_run_slice() */
+    bool cancel;         /* set by zf_run_cancel() */
+    const char *eval_pos; /* character of the outermost evaluation being handled */
+    uint8_t *snap;        /* active snapshot, with its undo log, see zf_snapshot() */
+    size_t snap_log, snap_used, snap_size;
+    zf_addr snap_here, snap_pad, snap_data; /* ends of the memory it shares */
+};
+
+static zf_ctx ctx_default;
+static ZF_THREAD_LOCAL zf_ctx *ctx = &ctx_default;
+
+/* Memory region sizes: constants from zfconf.h, or chosen by zf_init() */
+
+#if ZF_ENABLE_DYNAMIC_MEM
+#define DICT_SIZE (ctx->dict_size)
+#define PAD_SIZE (ctx->pad_size)
+#define STACK_SIZE (ctx->stack_size)
+#define DATA_SIZE (ctx->data_size)
+#else
+#define DICT_SIZE (ZF_DICT_SIZE)
+#define PAD_SIZE (ZF_PAD_SIZE)
+#define STACK_SIZE (ZF_STACK_SIZE)
+#define DATA_SIZE (ZF_DATA_SIZE)
+#endif
+
+/* The dictionary, PAD and stacks, followed by the data space for large
+ * arrays, which is not part of images */
+
+#define ZF_CORE_SIZE (DICT_SIZE + STACK_SIZE + PAD_SIZE)
+#define ZF_DSTACK (ZF_CORE_SIZE - STACK_SIZE)
+#define ZF_RSTACK (ZF_CORE_SIZE - sizeof(zf_cell))
+#define ZF_PAD DICT_SIZE
+#define ZF_DATA ((ZF_CORE_SIZE + sizeof(zf_cell) - 1) & ~(zf_addr)(sizeof(zf_cell) - 1))
+#define ZF_BLOCKS ((ZF_DATA + DATA_SIZE + sizeof(zf_cell) - 1) & ~(zf_addr)(sizeof(zf_cell) - 1))
+#define ZF_MEMORY_SIZE (ZF_BLOCKS + ZF_BLOCK_BUFFERS * ZF_BLOCK_SIZE)
+
+#if ZF_BLOCK_BUFFERS < 1
+#error "ZF_BLOCK_BUFFERS must be at least 1"
+#endif
 
 /* Flags and length encoded in words */
 
 #define ZF_FLAG_IMMEDIATE (1 << 6)
 #define ZF_FLAG_PRIM (1 << 5)
 #define ZF_FLAG_HIDDEN (1 << 4)
+#define ZF_FLAG_CREATE (1 << 3)
+#define ZF_FLAG_CONST (1 << 2)
 
 /* This macro is used to perform boundary checks. If ZF_ENABLE_BOUNDARY_CHECKS
  * is set to 0, the boundary check code will not be compiled in to reduce size
@@ -39,6 +144,16 @@
 #define PRIM_EXIT 0
 #define PRIM_LIT 4
 #define PRIM_LITS 5
+#define PRIM_JMP 28
+#define PRIM_JMP0 29
+#define PRIM_TICKC 31
+#define PRIM_FETCH 62
+#define PRIM_STORE 63
+#define PRIM_COMMA 64
+#define PRIM_ADDR 77
+#define PRIM_VALUE 78
+#define PRIM_TO 79
+#define PRIM_DOES 80
 
 static const char *prim_names[] = {
     "exit",
@@ -96,43 +211,95 @@ static const char *prim_names[] = {
     "search",
     "atoi",
     "atof",
+    "compact",
+    "allocate",
+    "free",
+    "resize",
+    "xallot",
+    "xhere",
+    "xrelease",
+    "@",
+    "!",
+    ",",
+    "@v",
+    "!v",
+    ",v",
+    "@u8",
+    "@s8",
+    "@u16",
+    "@s16",
+    "@u32",
+    "@s32",
+    "!8",
+    "!16",
+    "!32",
+    "(addr)",
+    "(value)",
+    "(to)",
+    "(does)",
+    "constant",
+    "value",
+    "_to",
+    "_does>",
+    "fill",
+    "cell-fill",
+    "block",
+    "buffer",
+    "update",
+    "save-buffers",
+    "empty-buffers",
+    "flush",
+    "task",
+    "activate",
+    "pause",
+    "stop",
+    "catch",
+    "throw",
 };
 
 static const size_t prim_count = sizeof(prim_names) / sizeof(const char *);
 
-/* Stacks and dictionary memory */
-
-static uint8_t *mem = NULL;
+/* Second names of primitives, for the cell width next to the other widths */
 
-/* State and interpreter pointers */
-
-static zf_input_state input_state;
-static zf_addr ip;
-
-/* setjmp env for handling aborts */
-
-static jmp_buf jmpbuf;
+static const struct
+{
+    const char *name;
+    int op;
+} prim_aliases[] = {
+    {"@c", PRIM_FETCH},
+    {"!c", PRIM_STORE},
+    {",c", PRIM_COMMA},
+};
 
 /* User variables are variables which are shared between forth and C. From
  * forth these can be accessed with @ and ! at pseudo-indices in low memory, in
  * C they are stored in an array of zf_addr with friendly reference names
  * through some macros */
 
-#define HERE uservar[0]      /* compilation pointer in dictionary */
-#define LATEST uservar[1]    /* pointer to last compiled word */
-#define TRACE uservar[2]     /* trace enable flag */
-#define COMPILING uservar[3] /* compiling flag */
-#define POSTPONE uservar[4]  /* flag to indicate next imm word should be compiled */
-#define DSTACK uservar[5]    /* dstack pointer */
-#define RSTACK uservar[6]    /* rstack pointer */
-#define PAD uservar[7]       /* PAD pointer */
+#define HERE ctx->uservar[0]      /* compilation pointer in dictionary */
+#define LATEST ctx->uservar[1]    /* pointer to last compiled word */
+#define TRACE ctx->uservar[2]     /* trace enable flag */
+#define COMPILING ctx->uservar[3] /* compiling flag */
+#define POSTPONE ctx->uservar[4]  /* flag to indicate next imm word should be compiled */
+#define DSTACK ctx->uservar[5]    /* dstack pointer */
+#define RSTACK ctx->uservar[6]    /* rstack pointer */
+#define PAD ctx->uservar[7]       /* PAD pointer */
 #define USERVAR_COUNT 8
 
+/* The literal pool follows the user variables: the number of entries, then
+ * the entries, see dict_add_lit() */
+
+#if ZF_LIT_POOL_SIZE > 61
+#error "ZF_LIT_POOL_SIZE is at most 61"
+#endif
+
+#define LIT_POOL (USERVAR_COUNT * sizeof(zf_addr))
+#define LIT_POOL_END (LIT_POOL + (1 + ZF_LIT_POOL_SIZE) * sizeof(zf_cell))
+#define LIT_POOL_TAG 0xc0
+
 static const char uservar_names[] = _("h") _("latest") _("trace") _("compiling")
     _("_postpone") _("dstack") _("rstack") _("pad");
 
-static zf_addr *uservar;
-
 /* Prototypes */
 
 static void do_prim(int prim, const char *input);
@@ -140,24 +307,32 @@ static zf_addr dict_get_cell(zf_addr addr, zf_cell *v);
 static void dict_get_bytes(zf_addr addr, void *buf, size_t len);
 static zf_addr dict_get_cell_typed(zf_addr addr, zf_cell *v, zf_mem_size size);
 static zf_addr dict_put_cell_typed(zf_addr addr, zf_cell v, zf_mem_size size);
+static bool code_step(zf_addr *addr, zf_addr end, zf_addr *reach, zf_cell *op, zf_addr *arg);
+static zf_addr code_limit(zf_addr code, int flags, zf_addr end);
+static zf_addr cell_width(zf_cell v);
+
+/* The trace macro tests the flag first, so that arguments like op_name(),
+ * which walks the dictionary, are not evaluated for every instruction */
 
 #if ZF_ENABLE_TRACE
 
-static void trace(const char *fmt, ...)
+static void do_trace(const char *fmt, ...)
 {
-    if (TRACE)
-    {
-        va_list va;
-        va_start(va, fmt);
-        zf_host_trace(fmt, va);
-        va_end(va);
-    }
+    va_list va;
+    va_start(va, fmt);
+    zf_host_trace(fmt, va);
+    va_end(va);
 }
 
+#define trace(...)                \
+    do                            \
+    {                             \
+        if (TRACE)                \
+            do_trace(__VA_ARGS__); \
+    } while (0)
+
 #else
-static void trace(const char *fmt, ...)
-{
-}
+#define trace(...)
 #endif
 
 static const char *op_name(zf_addr addr)
@@ -173,13 +348,13 @@ static const char *op_name(zf_addr addr)
         p += dict_get_cell(p, &d);
         flags = d;
         p += dict_get_cell(p, &link);
-        xt = p + strlen((const char *)&mem[p]) + 1;
+        xt = p + strlen((const char *)&ctx->mem[p]) + 1;
         dict_get_cell(xt, &op2);
 
         if (((flags & ZF_FLAG_PRIM) && addr == (zf_addr)op2) || addr == w ||
             addr == xt)
         {
-            return (const char *)&mem[p];
+            return (const char *)&ctx->mem[p];
         }
 
         w = link;
@@ -189,12 +364,20 @@ static const char *op_name(zf_addr addr)
 
 /*
  * Handle abort by unwinding the C stack and sending control back into
- * zf_eval()
+ * zf_eval() or zf_call(), which go on after the innermost 'catch' if there is
+ * one, see catching()
  */
 
 void zf_abort(zf_result reason)
 {
-    longjmp(jmpbuf, reason);
+    longjmp(*ctx->jmp, reason);
+}
+
+/* The code of a 'throw' which ended an evaluation with ZF_ABORT_THROW */
+
+zf_cell zf_throw_code(void)
+{
+    return ctx->thrown;
 }
 
 /*
@@ -212,7 +395,7 @@ void zf_push(zf_cell v)
 zf_cell zf_pop(void)
 {
     zf_cell v;
-    CHECK(DSTACK > ZF_DSTACK, ZF_ABORT_DSTACK_UNDERRUN);
+    CHECK(DSTACK > ctx->s0, ZF_ABORT_DSTACK_UNDERRUN);
     DSTACK -= sizeof(zf_cell);
     dict_get_cell_typed(DSTACK, &v, ZF_MEM_SIZE_CELL);
     trace("«" ZF_CELL_FMT " ", v);
@@ -223,14 +406,14 @@ zf_cell zf_pick(zf_addr n)
 {
     zf_cell v;
     zf_addr addr = DSTACK - (n + 1) * sizeof(zf_cell);
-    CHECK(addr >= ZF_DSTACK, ZF_ABORT_DSTACK_UNDERRUN);
+    CHECK(addr >= ctx->s0, ZF_ABORT_DSTACK_UNDERRUN);
     dict_get_cell_typed(addr, &v, ZF_MEM_SIZE_CELL);
     return v;
 }
 
 unsigned int zf_dstack_count()
 {
-    return (DSTACK - ZF_DSTACK) / sizeof(zf_cell);
+    return (DSTACK - ctx->s0) / sizeof(zf_cell);
 }
 
 static void zf_pushr(zf_cell v)
@@ -244,7 +427,7 @@ static void zf_pushr(zf_cell v)
 static zf_cell zf_popr(void)
 {
     zf_cell v;
-    CHECK(RSTACK < ZF_RSTACK, ZF_ABORT_RSTACK_UNDERRUN);
+    CHECK(RSTACK < ctx->r0, ZF_ABORT_RSTACK_UNDERRUN);
     RSTACK += sizeof(zf_cell);
     dict_get_cell_typed(RSTACK, &v, ZF_MEM_SIZE_CELL);
     trace("r«" ZF_CELL_FMT " ", v);
@@ -255,36 +438,63 @@ zf_cell zf_pickr(zf_addr n)
 {
     zf_cell v;
     zf_addr addr = RSTACK + (n + 1) * sizeof(zf_cell);
-    CHECK(addr <= ZF_RSTACK, ZF_ABORT_RSTACK_UNDERRUN);
+    CHECK(addr <= ctx->r0, ZF_ABORT_RSTACK_UNDERRUN);
     dict_get_cell_typed(addr, &v, ZF_MEM_SIZE_CELL);
     return v;
 }
 
 unsigned int zf_rstack_count()
 {
-    return (ZF_RSTACK - RSTACK) / sizeof(zf_cell);
+    return (ctx->r0 - RSTACK) / sizeof(zf_cell);
 }
 
 /*
  * All access to dictionary memory is done through these functions.
  */
 
+/* Stores to memory shared with a snapshot log the old bytes first */
+
+static void snap_keep(zf_addr addr, size_t len);
+#define SNAP_KEEP(addr, len) \
+    if (ctx->snap)           \
+        snap_keep(addr, len);
+
 static zf_addr dict_put_bytes(zf_addr addr, const void *buf, size_t len)
 {
-    const uint8_t *p = (const uint8_t *)buf;
-    size_t i = len;
     CHECK(addr <= ZF_MEMORY_SIZE - len, ZF_ABORT_OUTSIDE_MEM);
-    while (i--)
-        mem[addr++] = *p++;
+    SNAP_KEEP(addr, len);
+    memcpy(&ctx->mem[addr], buf, len);
     return len;
 }
 
 static void dict_get_bytes(zf_addr addr, void *buf, size_t len)
 {
-    uint8_t *p = (uint8_t *)buf;
     CHECK(addr <= ZF_MEMORY_SIZE - len, ZF_ABORT_OUTSIDE_MEM);
-    while (len--)
-        *p++ = mem[addr++];
+    memcpy(buf, &ctx->mem[addr], len);
+}
+
+/*
+ * Whole cells, with a single load or store when aligned
+ */
+
+static zf_cell cell_load(zf_addr addr)
+{
+    zf_cell v;
+    CHECK(addr <= ZF_MEMORY_SIZE - sizeof(zf_cell), ZF_ABORT_OUTSIDE_MEM);
+    if (addr % sizeof(zf_cell) == 0)
+        return *(zf_cell *)&ctx->mem[addr];
+    memcpy(&v, &ctx->mem[addr], sizeof(v));
+    return v;
+}
+
+static void cell_store(zf_addr addr, zf_cell v)
+{
+    CHECK(addr <= ZF_MEMORY_SIZE - sizeof(zf_cell), ZF_ABORT_OUTSIDE_MEM);
+    SNAP_KEEP(addr, sizeof(zf_cell));
+    if (addr % sizeof(zf_cell) == 0)
+        *(zf_cell *)&ctx->mem[addr] = v;
+    else
+        memcpy(&ctx->mem[addr], &v, sizeof(v));
 }
 
 /*
@@ -294,7 +504,16 @@ static void dict_get_bytes(zf_addr addr, void *buf, size_t len)
  *
  *    integer   0 ..   127  0xxxxxxx
  *    integer 128 .. 16383  10xxxxxx xxxxxxxx
+ *    literal pool entry    11xxxxxx               (0xc0 + index)
+ *    integer below 2^32    11111101 <uint32_t>
+ *    exact as a float      11111110 <float>
  *    else                  11111111 <raw copy of zf_cell>
+ *
+ * The last three have a fixed width, so a cell can be patched with any
+ * value of its kind, see dict_patch_cell().
+ *
+ * Data cells (ZF_MEM_SIZE_CELL, used by @ and !) are raw copies of zf_cell,
+ * see cell_load() and cell_store().
  */
 
 #if ZF_ENABLE_TYPED_MEM_ACCESS
@@ -317,39 +536,74 @@ static void dict_get_bytes(zf_addr addr, void *buf, size_t len)
 #define PUT(s, t, val)
 #endif
 
-static zf_addr dict_put_cell_typed(zf_addr addr, zf_cell v, zf_mem_size size)
+/* Integer value of a cell which holds one below 2^32 */
+
+static bool cell_u32(zf_cell v, uint32_t *u)
 {
-    unsigned int vi = v;
-    uint8_t t[2];
+    if (!(v >= 0 && v <= 4294967295.0))
+        return false;
+    *u = v;
+    return *u == v;
+}
 
-    trace("\n+" ZF_ADDR_FMT " " ZF_ADDR_FMT, addr, (zf_addr)v);
+/* Variable length encoding of 'v' in 't', returns its length */
 
-    if (size == ZF_MEM_SIZE_VAR)
+static zf_addr cell_encode(uint8_t *t, zf_cell v)
+{
+    uint32_t u;
+    float f = v;
+
+    if (cell_u32(v, &u))
     {
-        if ((v - vi) == 0)
+        if (u < 128)
         {
-            if (vi < 128)
-            {
-                trace(" ¹");
-                t[0] = vi;
-                return dict_put_bytes(addr, t, 1);
-            }
-            if (vi < 16384)
-            {
-                trace(" ²");
-                t[0] = (vi >> 8) | 0x80;
-                t[1] = vi;
-                return dict_put_bytes(addr, t, sizeof(t));
-            }
+            trace(" ¹");
+            t[0] = u;
+            return 1;
         }
+        if (u < 16384)
+        {
+            trace(" ²");
+            t[0] = (u >> 8) | 0x80;
+            t[1] = u;
+            return 2;
+        }
+        trace(" ³");
+        t[0] = 0xfd;
+        memcpy(t + 1, &u, sizeof(u));
+        return 1 + sizeof(u);
+    }
+
+    if ((zf_cell)f == v)
+    {
+        trace(" ⁴");
+        t[0] = 0xfe;
+        memcpy(t + 1, &f, sizeof(f));
+        return 1 + sizeof(f);
+    }
+
+    trace(" ⁵");
+    t[0] = 0xff;
+    memcpy(t + 1, &v, sizeof(v));
+    return 1 + sizeof(v);
+}
 
-        trace(" ⁵");
-        t[0] = 0xff;
-        return dict_put_bytes(addr + 0, t, 1) +
-               dict_put_bytes(addr + 1, &v, sizeof(v));
+static zf_addr dict_put_cell_typed(zf_addr addr, zf_cell v, zf_mem_size size)
+{
+    unsigned int vi = v;
+    uint8_t t[1 + sizeof(zf_cell)];
+
+    trace("\n+" ZF_ADDR_FMT " " ZF_ADDR_FMT, addr, (zf_addr)v);
+
+    if (size == ZF_MEM_SIZE_CELL)
+    {
+        cell_store(addr, v);
+        return sizeof(zf_cell);
     }
 
-    PUT(ZF_MEM_SIZE_CELL, zf_cell, v);
+    if (size == ZF_MEM_SIZE_VAR)
+        return dict_put_bytes(addr, t, cell_encode(t, v));
+
     PUT(ZF_MEM_SIZE_U8, uint8_t, vi);
     PUT(ZF_MEM_SIZE_U16, uint16_t, vi);
     PUT(ZF_MEM_SIZE_U32, uint32_t, vi);
@@ -364,10 +618,16 @@ static zf_addr dict_put_cell_typed(zf_addr addr, zf_cell v, zf_mem_size size)
 static zf_addr dict_get_cell_typed(zf_addr addr, zf_cell *v, zf_mem_size size)
 {
     uint8_t t[2];
-    dict_get_bytes(addr, t, sizeof(t));
+
+    if (size == ZF_MEM_SIZE_CELL)
+    {
+        *v = cell_load(addr);
+        return sizeof(zf_cell);
+    }
 
     if (size == ZF_MEM_SIZE_VAR)
     {
+        dict_get_bytes(addr, t, sizeof(t));
         if (t[0] & 0x80)
         {
             if (t[0] == 0xff)
@@ -375,6 +635,25 @@ static zf_addr dict_get_cell_typed(zf_addr addr, zf_cell *v, zf_mem_size size)
                 dict_get_bytes(addr + 1, v, sizeof(*v));
                 return 1 + sizeof(*v);
             }
+            else if (t[0] == 0xfd)
+            {
+                uint32_t u;
+                dict_get_bytes(addr + 1, &u, sizeof(u));
+                *v = u;
+                return 1 + sizeof(u);
+            }
+            else if (t[0] == 0xfe)
+            {
+                float f;
+                dict_get_bytes(addr + 1, &f, sizeof(f));
+                *v = f;
+                return 1 + sizeof(f);
+            }
+            else if (t[0] >= LIT_POOL_TAG)
+            {
+                *v = cell_load(LIT_POOL + (1 + t[0] - LIT_POOL_TAG) * sizeof(zf_cell));
+                return 1;
+            }
             else
             {
                 *v = ((t[0] & 0x3f) << 8) + t[1];
@@ -388,7 +667,6 @@ static zf_addr dict_get_cell_typed(zf_addr addr, zf_cell *v, zf_mem_size size)
         }
     }
 
-    GET(ZF_MEM_SIZE_CELL, zf_cell);
     GET(ZF_MEM_SIZE_U8, uint8_t);
     GET(ZF_MEM_SIZE_U16, uint16_t);
     GET(ZF_MEM_SIZE_U32, uint32_t);
@@ -421,6 +699,8 @@ static zf_addr dict_get_cell(zf_addr addr, zf_cell *v)
 
 static void dict_add_cell_typed(zf_addr addr, zf_cell v, zf_mem_size size)
 {
+    if (addr > DICT_SIZE - sizeof(zf_cell) - 1)
+        zf_abort(ZF_ABORT_OUTSIDE_DICT);
     HERE += dict_put_cell_typed(addr, v, size);
     trace(" ");
 }
@@ -436,9 +716,42 @@ static void dict_add_op(zf_addr op)
     trace("+%s ", op_name(op));
 }
 
+/*
+ * Literals which take more than two bytes are added to the literal pool while
+ * it has room, and compiled as a one byte reference to their entry. Entries
+ * are compared by their bits, so that NaNs are pooled as well
+ */
+
 static void dict_add_lit(zf_cell v)
 {
     dict_add_op(PRIM_LIT);
+
+    if (cell_width(v) > 2)
+    {
+        zf_addr n = cell_load(LIT_POOL), i;
+        for (i = 0; i < n; i++)
+        {
+            zf_cell e = cell_load(LIT_POOL + (1 + i) * sizeof(zf_cell));
+            if (memcmp(&e, &v, sizeof(v)) == 0)
+                break;
+        }
+        if (i == n && n < ZF_LIT_POOL_SIZE)
+        {
+            cell_store(LIT_POOL + (1 + i) * sizeof(zf_cell), v);
+            cell_store(LIT_POOL, n + 1);
+        }
+        if (i < ZF_LIT_POOL_SIZE)
+        {
+            uint8_t t = LIT_POOL_TAG + i;
+            if (HERE >= DICT_SIZE)
+                zf_abort(ZF_ABORT_OUTSIDE_DICT);
+            trace("\n+" ZF_ADDR_FMT " " ZF_ADDR_FMT " ᵖ ", HERE, (zf_addr)v);
+            dict_put_bytes(HERE, &t, 1);
+            HERE++;
+            return;
+        }
+    }
+
     dict_add_cell(v);
 }
 
@@ -447,8 +760,293 @@ static void dict_add_str(const char *s)
     size_t l;
     trace("\n+" ZF_ADDR_FMT " " ZF_ADDR_FMT " s '%s'", HERE, 0, s);
     l = strlen(s);
-    HERE += dict_put_bytes(HERE, s, l);
-    mem[HERE++] = 0;
+    if (HERE + l >= DICT_SIZE)
+        zf_abort(ZF_ABORT_OUTSIDE_DICT);
+    HERE += dict_put_bytes(HERE, s, l + 1);
+}
+
+/*
+ * PAD memory. Transient data is bump allocated upwards from ZF_PAD by the
+ * PAD pointer, and all of it is released when the outermost zf_eval()
+ * returns: PAD addresses must not be used after the line which made them,
+ * data which has to last goes to the heap or the dictionary. The top of the PAD is a heap for
+ * 'allocate', growing downwards: blocks have a power of two size class, and
+ * freed blocks are kept in one list per class, so all operations are O(1).
+ * The heap state is kept in the PAD itself, and saved with images.
+ */
+
+#define HEAP_CLASSES 32
+#define HEAP_MIN_CLASS 4
+#define HEAP_HDR 8 /* size class and free flag, keeps payloads cell aligned */
+#define HEAP_FREE 0x80000000
+
+typedef struct
+{
+    zf_addr bottom;               /* lowest block */
+    zf_addr free[HEAP_CLASSES];   /* free blocks of each size class */
+} heap_meta;
+
+#define HEAP_META ((ZF_PAD + PAD_SIZE - sizeof(heap_meta)) & ~(zf_addr)7)
+#define HEAP_TOP (HEAP_META + sizeof(heap_meta))
+
+
+static heap_meta *heap(void)
+{
+    return (heap_meta *)&ctx->mem[HEAP_META];
+}
+
+static void heap_init(void)
+{
+    memset(heap(), 0, sizeof(heap_meta));
+    heap()->bottom = HEAP_META;
+}
+
+static void pad_check(size_t len)
+{
+    if (len > heap()->bottom - PAD)
+        zf_abort(ZF_ABORT_OUTSIDE_PAD);
+}
+
+static void pad_release(void)
+{
+    PAD = ZF_PAD;
+}
+
+static zf_addr *heap_hdr(zf_addr addr)
+{
+    zf_addr block = addr - HEAP_HDR;
+    if (addr < HEAP_HDR || block < heap()->bottom || block >= HEAP_META)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    zf_addr *hdr = (zf_addr *)&ctx->mem[block];
+    if (*hdr >= HEAP_CLASSES)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    return hdr;
+}
+
+static zf_addr heap_alloc(size_t size)
+{
+    heap_meta *h = heap();
+    int c = HEAP_MIN_CLASS;
+    zf_addr block;
+
+    while (((size_t)1 << c) < size + HEAP_HDR)
+        if (++c == HEAP_CLASSES)
+            zf_abort(ZF_ABORT_INVALID_SIZE);
+
+    block = h->free[c];
+    if (block)
+    {
+        h->free[c] = *(zf_addr *)&ctx->mem[block + HEAP_HDR];
+    }
+    else
+    {
+        pad_check((size_t)1 << c);
+        h->bottom -= (zf_addr)1 << c;
+        block = h->bottom;
+    }
+    *(zf_addr *)&ctx->mem[block] = c;
+    return block + HEAP_HDR;
+}
+
+static void heap_free(zf_addr addr)
+{
+    heap_meta *h = heap();
+    zf_addr *hdr = heap_hdr(addr);
+    zf_addr c = *hdr;
+    zf_addr block = addr - HEAP_HDR;
+
+    if (block == h->bottom)
+    {
+        h->bottom += (zf_addr)1 << c;
+        return;
+    }
+    *hdr = c | HEAP_FREE;
+    *(zf_addr *)&ctx->mem[addr] = h->free[c];
+    h->free[c] = block;
+}
+
+static zf_addr heap_resize(zf_addr addr, size_t size)
+{
+    zf_addr c = *heap_hdr(addr);
+    size_t len = ((size_t)1 << c) - HEAP_HDR;
+
+    if (size <= len)
+        return addr;
+    zf_addr n = heap_alloc(size);
+    memcpy(&ctx->mem[n], &ctx->mem[addr], len);
+    heap_free(addr);
+    return n;
+}
+
+/*
+ * Block buffers: an LRU cache of ZF_BLOCK_BUFFERS blocks above the data space.
+ * A dirty buffer is written back when it is reused, or with all others, in
+ * block order, by 'save-buffers' and 'flush'. The buffers are not saved with
+ * the dictionary.
+ */
+
+#define BLOCK_ADDR(i) (ZF_BLOCKS + (zf_addr)(i) * ZF_BLOCK_SIZE)
+
+static void block_reset(void)
+{
+    memset(ctx->block_bufs, 0, sizeof(ctx->block_bufs));
+    ctx->block_cur = -1;
+}
+
+static void block_io_error(void)
+{
+    zf_host_block_done();
+    zf_abort(ZF_ABORT_BLOCK_IO);
+}
+
+static void block_write(int i)
+{
+    if (ctx->snap)
+        zf_abort(ZF_ABORT_BLOCK_IO);
+    if (!zf_host_block_write(ctx->block_bufs[i].blk, &ctx->mem[BLOCK_ADDR(i)]))
+        block_io_error();
+    ctx->block_bufs[i].dirty = false;
+}
+
+/* Address of the buffer holding block 'blk', reading it in if 'read' */
+
+static zf_addr block_get(zf_cell v, bool read)
+{
+    unsigned int blk = v;
+    int i, victim = 0;
+
+    if (v < 0 || v != blk)
+        zf_abort(ZF_ABORT_BLOCK_IO);
+
+    for (i = 0; i < ZF_BLOCK_BUFFERS; i++)
+    {
+        if (ctx->block_bufs[i].used && ctx->block_bufs[i].blk == blk)
+            break;
+        if (ctx->block_bufs[i].used < ctx->block_bufs[victim].used)
+            victim = i;
+    }
+
+    if (i == ZF_BLOCK_BUFFERS)
+    {
+        if (ctx->snap)
+            zf_abort(ZF_ABORT_BLOCK_IO);
+        i = victim;
+        if (ctx->block_bufs[i].used && ctx->block_bufs[i].dirty)
+            block_write(i);
+        ctx->block_bufs[i].used = 0;
+        if (read && !zf_host_block_read(blk, &ctx->mem[BLOCK_ADDR(i)]))
+            block_io_error();
+        zf_host_block_done();
+        ctx->block_bufs[i].blk = blk;
+        ctx->block_bufs[i].dirty = false;
+    }
+
+    ctx->block_bufs[i].used = ++ctx->block_tick;
+    ctx->block_cur = i;
+    return BLOCK_ADDR(i);
+}
+
+static void block_save(void)
+{
+    for (;;)
+    {
+        int i, first = -1;
+        for (i = 0; i < ZF_BLOCK_BUFFERS; i++)
+        {
+            if (ctx->block_bufs[i].used && ctx->block_bufs[i].dirty && (first < 0 || ctx->block_bufs[i].blk < ctx->block_bufs[first].blk))
+                first = i;
+        }
+        if (first < 0)
+            break;
+        block_write(first);
+    }
+    zf_host_block_done();
+}
+
+/*
+ * Size of the variable length encoding of a cell
+ */
+
+static zf_addr cell_width(zf_cell v)
+{
+    uint32_t u;
+    if (cell_u32(v, &u))
+        return u < 128 ? 1 : u < 16384 ? 2 : 1 + sizeof(u);
+    if ((zf_cell)(float)v == v)
+        return 1 + sizeof(float);
+    return 1 + sizeof(zf_cell);
+}
+
+#define ALIGNED(addr) (((addr) + sizeof(zf_cell) - 1) & ~(zf_addr)(sizeof(zf_cell) - 1))
+
+/*
+ * Code of a word with a data field: 'op' with the address of the data
+ * following it, aligned to a cell so that @ and ! are single loads and
+ * stores, then 'exit'. For 'create' words, a cell of the width of HERE
+ * follows, where does> can put the address of its code and turn the 'exit'
+ * into a 'jmp': that code was compiled before, so its address fits.
+ * References to these words copy the op inline, see dict_add_ref(). 'size'
+ * bytes of data are reserved by the caller, the whole word must fit.
+ */
+
+static void dict_add_data(zf_addr op, zf_addr size)
+{
+    zf_addr slot = op == PRIM_ADDR ? HERE : 0;
+    zf_addr fixed = 2 + (slot ? cell_width(slot) : 0);
+    zf_addr data = ALIGNED(HERE + fixed + 1), prev = 0;
+
+    while (data != prev)
+    {
+        prev = data;
+        data = ALIGNED(HERE + fixed + cell_width(prev));
+    }
+    if (data > DICT_SIZE || size > DICT_SIZE - data)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    dict_add_op(op);
+    dict_add_cell(data);
+    dict_add_op(PRIM_EXIT);
+    if (slot)
+        dict_add_cell(slot);
+    if (HERE < data)
+    {
+        SNAP_KEEP(HERE, data - HERE);
+        memset(&ctx->mem[HERE], 0, data - HERE);
+        HERE = data;
+    }
+}
+
+/*
+ * Compile a reference to a word. Constants and words with a data field are
+ * not called: their first instruction is copied, followed by a call to their
+ * does> code if they have one
+ */
+
+static void dict_add_ref(zf_addr code, int flags)
+{
+    zf_cell op, v;
+
+    if (!(flags & (ZF_FLAG_CREATE | ZF_FLAG_CONST)))
+    {
+        dict_add_op(code);
+        return;
+    }
+    code += dict_get_cell(code, &op);
+    code += dict_get_cell(code, &v);
+    if (op == PRIM_LIT)
+    {
+        dict_add_lit(v);
+    }
+    else
+    {
+        dict_add_op(op);
+        dict_add_cell(v);
+    }
+    code += dict_get_cell(code, &op);
+    if (op == PRIM_JMP)
+    {
+        dict_get_cell(code, &v);
+        dict_add_op(v);
+    }
 }
 
 /*
@@ -457,7 +1055,7 @@ static void dict_add_str(const char *s)
 
 static void create(const char *name, int flags)
 {
-    if (HERE >= ZF_DICT_SIZE)
+    if (HERE >= DICT_SIZE)
     {
         zf_abort(ZF_ABORT_OUTSIDE_DICT);
     }
@@ -472,6 +1070,32 @@ static void create(const char *name, int flags)
     trace("\n===");
 }
 
+/*
+ * Compile transactions. A definition which aborts halfway is removed with its
+ * header and the literals it added to the pool, so it can not be found or
+ * called
+ */
+
+static void txn_begin(void)
+{
+    ctx->txn_open = true;
+    ctx->txn_here = HERE;
+    ctx->txn_latest = LATEST;
+    ctx->txn_pool = cell_load(LIT_POOL);
+}
+
+static void txn_rollback(void)
+{
+    if (ctx->txn_open)
+    {
+        trace("\n=== rollback to " ZF_ADDR_FMT, ctx->txn_here);
+        ctx->txn_open = false;
+        HERE = ctx->txn_here;
+        LATEST = ctx->txn_latest;
+        cell_store(LIT_POOL, ctx->txn_pool);
+    }
+}
+
 /*
  * Find word in dictionary, returning address and execution token
  */
@@ -488,10 +1112,10 @@ static int find_word(const char *name, zf_addr *word, zf_addr *code)
         size_t len;
         p += dict_get_cell(p, &d);
         p += dict_get_cell(p, &link);
-        len = strlen((const char *)&mem[p]);
+        len = strlen((const char *)&ctx->mem[p]);
         if (len == namelen)
         {
-            const char *name2 = (const char *)&mem[p];
+            const char *name2 = (const char *)&ctx->mem[p];
             if (memcmp(name, name2, len) == 0)
             {
                 *word = w;
@@ -511,46 +1135,29 @@ static int find_word(const char *name, zf_addr *word, zf_addr *code)
 
 void zf_disassemble(const char *name)
 {
-    zf_addr addr, code;
-    if (!find_word(name, &addr, &code))
+    zf_addr w, code, a, reach, arg;
+    zf_cell flags, op, value;
+    if (!find_word(name, &w, &code))
     {
         zf_abort(ZF_ABORT_NOT_A_WORD);
     }
-    for (zf_addr a = code;;)
+    dict_get_cell(w, &flags);
+    zf_addr limit = code_limit(code, flags, HERE);
+    a = reach = code;
+    for (zf_addr at = a; code_step(&a, limit, &reach, &op, &arg); at = a)
     {
-        uint8_t val = mem[a];
-        zf_host_print("%8d    ", a);
-        if (val < prim_count)
+        zf_host_print("%8d    %s ", at, op < prim_count ? prim_names[(int)op] : op_name(op));
+        if (arg)
         {
-            a++;
-            zf_host_print("%s ", prim_names[val]);
-            if (val == PRIM_EXIT)
+            zf_addr p = arg + dict_get_cell(arg, &value);
+            zf_host_print("\n%8d    " ZF_CELL_FMT, arg, value);
+            if (op == PRIM_LITS)
             {
-                break;
-            }
-            else if (val == PRIM_LIT)
-            {
-                zf_cell value;
-                zf_host_print("\n%8d    ", a);
-                a += dict_get_cell(a, &value);
-                zf_host_print(ZF_CELL_FMT, value);
-            }
-            else if (val == PRIM_LITS)
-            {
-                zf_cell value;
-                zf_host_print("\n%8d    ", a);
-                a += dict_get_cell(a, &value);
-                zf_host_print(ZF_CELL_FMT "\n%8d    ", value, a);
-                for (int i = 0; i < value; i++, a++)
-                    zf_host_print("%d ", mem[a]);
+                zf_host_print("\n%8d    ", p);
+                for (int i = 0; i < value; i++)
+                    zf_host_print("%d ", ctx->mem[p + i]);
             }
         }
-        else
-        {
-            zf_cell value;
-            a += dict_get_cell(a, &value);
-            zf_host_print("%s ", op_name(value));
-        }
         zf_host_print("\n");
     }
 }
@@ -578,23 +1185,1019 @@ static void make_hidden(void)
 }
 
 /*
- * Inner interpreter
+ * Overwrite a variable length cell in place. The encoded size is kept, so
+ * the code following the cell does not move: 'v' has to fit the kind of
+ * cell which is there.
  */
 
-static void run(const char *input)
+static bool dict_cell_fits(zf_addr addr, zf_cell v)
 {
-    while (ip != 0)
-    {
-        zf_cell d;
-        zf_addr i, ip_org = ip;
-        zf_addr l = dict_get_cell(ip, &d);
-        zf_addr code = d;
+    uint8_t tag;
+    uint32_t u;
+
+    dict_get_bytes(addr, &tag, 1);
+    if (tag < 0x80 || (tag >= LIT_POOL_TAG && tag < 0xfd))
+        return cell_u32(v, &u) && u < 128;
+    if (tag < LIT_POOL_TAG)
+        return cell_u32(v, &u) && u < 16384;
+    if (tag == 0xfd)
+        return cell_u32(v, &u);
+    if (tag == 0xfe)
+        return (zf_cell)(float)v == v;
+    return true;
+}
 
-        trace("\n " ZF_ADDR_FMT " " ZF_ADDR_FMT " ", ip, code);
-        for (i = 0; i < zf_rstack_count(); i++)
-            trace("┊  ");
+static void dict_patch_cell(zf_addr addr, zf_cell v)
+{
+    uint8_t t[2], tag;
+    uint32_t u = 0;
+    float f = v;
+
+    if (!dict_cell_fits(addr, v))
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+
+    cell_u32(v, &u);
+    dict_get_bytes(addr, &tag, 1);
+    if (tag < 0x80 || (tag >= LIT_POOL_TAG && tag < 0xfd))
+    {
+        t[0] = u;
+        dict_put_bytes(addr, t, 1);
+    }
+    else if (tag < LIT_POOL_TAG)
+    {
+        t[0] = (u >> 8) | 0x80;
+        t[1] = u;
+        dict_put_bytes(addr, t, sizeof(t));
+    }
+    else if (tag == 0xfd)
+    {
+        dict_put_bytes(addr + 1, &u, sizeof(u));
+    }
+    else if (tag == 0xfe)
+    {
+        dict_put_bytes(addr + 1, &f, sizeof(f));
+    }
+    else
+    {
+        dict_put_bytes(addr + 1, &v, sizeof(v));
+    }
+}
+
+/*
+ * Step through the code of a word. Returns the opcode (or call address) of
+ * the instruction at '*addr' in 'op' and the address of its operand in 'arg'
+ * (0 if none), then moves '*addr' to the next instruction. '*reach' keeps the
+ * farthest forward jump, so that an 'exit' inside a conditional does not end
+ * the word.
+ */
+
+static bool code_step(zf_addr *addr, zf_addr end, zf_addr *reach, zf_cell *op, zf_addr *arg)
+{
+    zf_cell v;
+    zf_addr p;
+
+    if (*addr >= end)
+        return false;
+
+    p = *addr + dict_get_cell(*addr, op);
+    *arg = 0;
+
+    if (*op < prim_count)
+    {
+        switch ((int)*op)
+        {
+        case PRIM_LITS:
+            *arg = p;
+            p += dict_get_cell(p, &v);
+            p += v;
+            break;
+        case PRIM_JMP:
+        case PRIM_JMP0:
+            *arg = p;
+            p += dict_get_cell(p, &v);
+            if (v > *reach)
+                *reach = v;
+            break;
+        case PRIM_LIT:
+        case PRIM_TICKC:
+        case PRIM_ADDR:
+        case PRIM_VALUE:
+        case PRIM_TO:
+            *arg = p;
+            p += dict_get_cell(p, &v);
+            break;
+        case PRIM_EXIT:
+            if (p > *reach)
+                p = end;
+            break;
+        }
+    }
+
+    *addr = p;
+    return true;
+}
+
+/*
+ * Words with a data field have fixed code: an address or value op, then 'exit'
+ * or a 'jmp' to their does> code. The data after it is not code.
+ */
+
+static zf_addr code_limit(zf_addr code, int flags, zf_addr end)
+{
+    zf_addr a = code, reach = code, arg;
+    zf_cell op;
+
+    if (!(flags & ZF_FLAG_CREATE))
+        return end;
+    code_step(&a, end, &reach, &op, &arg);
+    code_step(&a, end, &reach, &op, &arg);
+    return a;
+}
+
+/*
+ * Dictionary compaction. Words which are shadowed by a newer definition with
+ * the same name, and which are not called from any live word, are removed.
+ * The remaining words are moved down, and their links, calls, jumps, ['] xts
+ * and 'create' data addresses are rewritten. Addresses kept in variables or
+ * on the stacks are not updated, so this only runs when no word is executing.
+ * An xt can also be kept as a number, in a literal, a constant, a data field,
+ * the PAD or on the stack. Any such number pins the word it is the xt of:
+ * that word and all below it are kept where they are.
+ *
+ * For an export, the live set is instead what can be reached from the entry
+ * word, plus the primitives and user variables needed by the interpreter.
+ * The names of the other words can be dropped: they become hidden words with
+ * an empty name.
+ *
+ * The literal pool is filled first come while compiling. Both also count the
+ * wide literals of the moved words and give the pool entries to those which
+ * save the most bytes, see compact_pool().
+ */
+
+typedef struct
+{
+    zf_addr hdr;  /* header address */
+    zf_addr name; /* name string */
+    zf_addr code; /* first instruction */
+    zf_addr end;  /* next header, or HERE */
+    zf_addr dest; /* header address after compaction */
+    zf_addr drop; /* name bytes dropped */
+    int flags;
+    bool root;
+    bool live;
+} compact_word;
+
+static int compact_find(compact_word *words, int count, zf_addr addr)
+{
+    int lo = 0, hi = count - 1;
+
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (addr < words[mid].hdr)
+            hi = mid - 1;
+        else if (addr >= words[mid].end)
+            lo = mid + 1;
+        else
+            return mid;
+    }
+    return -1;
+}
+
+/* A literal whose encoding changes */
+
+typedef struct
+{
+    zf_addr at;  /* operand address */
+    zf_addr len; /* encoded length */
+    zf_cell v;
+    int slot;   /* pool entry after compaction, or -1 */
+    long shift; /* length change of this literal and all before it */
+} compact_lit;
+
+typedef struct
+{
+    compact_lit *lits;
+    int count;
+} compact_plan;
+
+/* Length change of the literals before 'addr' */
+
+static long compact_shift(const compact_plan *plan, zf_addr addr)
+{
+    int lo = 0, hi = plan->count - 1, last = -1;
+
+    while (lo <= hi)
+    {
+        int mid = (lo + hi) / 2;
+        if (plan->lits[mid].at < addr)
+        {
+            last = mid;
+            lo = mid + 1;
+        }
+        else
+        {
+            hi = mid - 1;
+        }
+    }
+    return last < 0 ? 0 : plan->lits[last].shift;
+}
+
+static zf_addr compact_reloc(compact_word *words, int count, const compact_plan *plan, zf_addr addr)
+{
+    int i = compact_find(words, count, addr);
+    if (i < 0 || !words[i].live)
+        return addr;
+    long shift = compact_shift(plan, addr) - compact_shift(plan, words[i].hdr);
+    if (addr >= words[i].code)
+        addr -= words[i].drop;
+    return addr - words[i].hdr + words[i].dest + shift;
+}
+
+static void compact_mark(compact_word *words, int count, int *todo, int *ntodo, zf_addr addr)
+{
+    int i = compact_find(words, count, addr);
+    if (i >= 0 && !words[i].live)
+    {
+        words[i].live = true;
+        todo[(*ntodo)++] = i;
+    }
+}
+
+/* Index of the word whose xt is 'v', or -1 */
+
+static int compact_xt(compact_word *words, int count, zf_cell v)
+{
+    zf_addr addr = v;
+    int i;
+    if (addr != v)
+        return -1;
+    i = compact_find(words, count, addr);
+    return i >= 0 && words[i].code == addr ? i : -1;
+}
+
+/* Raise 'pin' to the last word whose xt is in a cell from 'from' to 'to' */
+
+static void compact_scan(compact_word *words, int count, zf_addr from, zf_addr to, int *pin)
+{
+    zf_addr a = (from + sizeof(zf_cell) - 1) & ~(zf_addr)(sizeof(zf_cell) - 1);
+    for (; a + sizeof(zf_cell) <= to; a += sizeof(zf_cell))
+    {
+        int i = compact_xt(words, count, cell_load(a));
+        if (i > *pin)
+            *pin = i;
+    }
+}
+
+/*
+ * Rank the wide literals of the live words above 'pin' by the bytes a pool
+ * entry saves them, all their uses together, and give the free entries to
+ * the best. The entries used by the pinned words keep their place. Fills
+ * 'plan' with the literals to encode again and 'pool' with the new entries,
+ * returns the number of entries, or -1 with an empty plan when out of
+ * memory.
+ */
+
+typedef struct
+{
+    zf_cell v;
+    int first; /* index of the first use */
+    int uses;
+    int slot;
+} compact_value;
+
+static int compact_by_value(const void *a, const void *b)
+{
+    const compact_value *x = a, *y = b;
+    int c = memcmp(&x->v, &y->v, sizeof(zf_cell));
+    return c ? c : x->first - y->first;
+}
+
+static int compact_by_saving(const void *a, const void *b)
+{
+    const compact_value *x = a, *y = b;
+    long sx = (long)x->uses * (cell_width(x->v) - 1);
+    long sy = (long)y->uses * (cell_width(y->v) - 1);
+    if (sx != sy)
+        return sx < sy ? 1 : -1;
+    return x->first - y->first;
+}
+
+static int compact_pool(compact_word *words, int count, int pin, compact_plan *plan, zf_cell *pool)
+{
+    bool fixed[ZF_LIT_POOL_SIZE] = {false};
+    compact_value *values = NULL;
+    int n = 0, size = 0, used = 0;
+    zf_addr a, arg, reach;
+    zf_cell op, v;
+    uint8_t tag;
+
+    for (int k = 0; k < ZF_LIT_POOL_SIZE; k++)
+        pool[k] = cell_load(LIT_POOL + (1 + k) * sizeof(zf_cell));
+
+    plan->lits = NULL;
+    plan->count = 0;
+    for (int i = 0; i < count; i++)
+    {
+        compact_word *cw = &words[i];
+        if (!cw->live)
+            continue;
+        zf_addr limit = code_limit(cw->code, cw->flags, cw->end);
+        a = reach = cw->code;
+        while (code_step(&a, limit, &reach, &op, &arg))
+        {
+            if (op != PRIM_LIT)
+                continue;
+            dict_get_bytes(arg, &tag, 1);
+            if (i <= pin)
+            {
+                if (tag >= LIT_POOL_TAG && tag < LIT_POOL_TAG + ZF_LIT_POOL_SIZE)
+                {
+                    fixed[tag - LIT_POOL_TAG] = true;
+                    if (tag - LIT_POOL_TAG >= used)
+                        used = tag - LIT_POOL_TAG + 1;
+                }
+                continue;
+            }
+            dict_get_cell(arg, &v);
+            if (cell_width(v) <= 2)
+                continue;
+            if (n == size)
+            {
+                size = size ? 2 * size : 64;
+                compact_lit *lits = realloc(plan->lits, size * sizeof(compact_lit));
+                if (!lits)
+                {
+                    free(plan->lits);
+                    plan->lits = NULL;
+                    return -1;
+                }
+                plan->lits = lits;
+            }
+            plan->lits[n].at = arg;
+            plan->lits[n].len = a - arg;
+            plan->lits[n].v = v;
+            n++;
+        }
+    }
+    plan->count = n;
+    if (n == 0)
+        return used;
+
+    values = malloc(n * sizeof(compact_value));
+    if (!values)
+    {
+        free(plan->lits);
+        plan->lits = NULL;
+        plan->count = 0;
+        return -1;
+    }
+
+    /* Count the uses of each value, equal bits being the same value */
+
+    for (int k = 0; k < n; k++)
+    {
+        values[k].v = plan->lits[k].v;
+        values[k].first = k;
+    }
+    qsort(values, n, sizeof(compact_value), compact_by_value);
+    int nv = 0;
+    for (int k = 0; k < n; k++)
+    {
+        if (nv > 0 && memcmp(&values[nv - 1].v, &values[k].v, sizeof(zf_cell)) == 0)
+        {
+            values[nv - 1].uses++;
+            continue;
+        }
+        values[nv] = values[k];
+        values[nv].uses = 1;
+        values[nv].slot = -1;
+        for (int e = 0; e < ZF_LIT_POOL_SIZE; e++)
+        {
+            if (fixed[e] && memcmp(&pool[e], &values[nv].v, sizeof(zf_cell)) == 0)
+                values[nv].slot = e;
+        }
+        nv++;
+    }
+
+    /* The free entries go to the values which save the most */
+
+    qsort(values, nv, sizeof(compact_value), compact_by_saving);
+    int e = 0;
+    for (int k = 0; k < nv; k++)
+    {
+        if (values[k].slot >= 0)
+            continue;
+        while (e < ZF_LIT_POOL_SIZE && fixed[e])
+            e++;
+        if (e == ZF_LIT_POOL_SIZE)
+            break;
+        values[k].slot = e;
+        pool[e++] = values[k].v;
+        if (e > used)
+            used = e;
+    }
+
+    /* Then each use gets the entry of its value, and its new length */
+
+    qsort(values, nv, sizeof(compact_value), compact_by_value);
+    long shift = 0;
+    for (int k = 0; k < n; k++)
+    {
+        compact_lit *lit = &plan->lits[k];
+        compact_value key = {lit->v, 0, 0, 0}, *found;
+        int lo = 0, hi = nv - 1;
+        found = NULL;
+        while (lo <= hi)
+        {
+            int mid = (lo + hi) / 2;
+            int c = memcmp(&values[mid].v, &key.v, sizeof(zf_cell));
+            if (c == 0)
+            {
+                found = &values[mid];
+                break;
+            }
+            if (c < 0)
+                lo = mid + 1;
+            else
+                hi = mid - 1;
+        }
+        lit->slot = found->slot;
+        shift += (long)(lit->slot >= 0 ? 1 : cell_width(lit->v)) - (long)lit->len;
+        lit->shift = shift;
+    }
+
+    free(values);
+    return used;
+}
+
+/* Copy the code from 'from' to 'to' to 'out', with the literals of 'plan'
+ * encoded again. '*k' is the next literal. Returns the length copied */
+
+static zf_addr compact_copy(uint8_t *out, zf_addr from, zf_addr to, const compact_plan *plan, int *k)
+{
+    zf_addr len = 0;
+
+    while (*k < plan->count && plan->lits[*k].at < to)
+    {
+        const compact_lit *lit = &plan->lits[(*k)++];
+        memcpy(out + len, &ctx->mem[from], lit->at - from);
+        len += lit->at - from;
+        if (lit->slot >= 0)
+            out[len++] = LIT_POOL_TAG + lit->slot;
+        else
+            len += cell_encode(out + len, lit->v);
+        from = lit->at + lit->len;
+    }
+    memcpy(out + len, &ctx->mem[from], to - from);
+    return len + to - from;
+}
+
+/* Place the live words, returns the new HERE */
+
+static zf_addr compact_place(compact_word *words, int count, int pin, bool strip, const compact_plan *plan)
+{
+    zf_addr dest = words[0].hdr;
+
+    for (int i = 0; i < count; i++)
+    {
+        compact_word *cw = &words[i];
+        if (cw->live)
+        {
+            cw->drop = 0;
+            if (strip && !cw->root && i > pin)
+                cw->drop = cw->code - cw->name - 1;
+            if (cw->flags & ZF_FLAG_CREATE)
+            {
+                /* keep the data aligned, without moving the word up */
+                zf_addr align = (cw->hdr + cw->drop - dest) % sizeof(zf_cell);
+                if (dest + align > cw->hdr)
+                {
+                    cw->drop = 0;
+                    align = (cw->hdr - dest) % sizeof(zf_cell);
+                }
+                dest += align;
+            }
+            cw->dest = dest;
+            dest += cw->end - cw->hdr - cw->drop + compact_shift(plan, cw->end) - compact_shift(plan, cw->hdr);
+        }
+    }
+    return dest;
+}
+
+/* Check that all the addresses to rewrite fit their cells */
+
+static bool compact_fits(compact_word *words, int count, const compact_plan *plan)
+{
+    zf_addr a, arg, reach, prev = 0;
+    zf_cell d, op;
+
+    for (int i = 0; i < count; i++)
+    {
+        compact_word *cw = &words[i];
+        if (!cw->live)
+            continue;
+        if (!dict_cell_fits(cw->hdr + dict_get_cell(cw->hdr, &d), prev))
+            return false;
+        prev = cw->dest;
+
+        zf_addr limit = code_limit(cw->code, cw->flags, cw->end);
+        a = reach = cw->code;
+        for (zf_addr at = a; code_step(&a, limit, &reach, &op, &arg); at = a)
+        {
+            if (op >= prim_count)
+            {
+                if (!dict_cell_fits(at, compact_reloc(words, count, plan, op)))
+                    return false;
+            }
+            else if (op == PRIM_JMP || op == PRIM_JMP0 || op == PRIM_TICKC || op == PRIM_ADDR ||
+                     op == PRIM_VALUE || op == PRIM_TO)
+            {
+                dict_get_cell(arg, &d);
+                if (d >= prim_count && !dict_cell_fits(arg, compact_reloc(words, count, plan, d)))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool compact_words(zf_addr entry, bool strip)
+{
+    compact_word *words;
+    int *todo;
+    int count = 0, ntodo = 0;
+    zf_addr w, a, arg, reach, dest;
+    zf_cell d, op;
+    zf_addr keep[USERVAR_COUNT + 1];
+    int nkeep = 0, pin = -1;
+
+    for (w = LATEST; w; w = d, count++)
+    {
+        w += dict_get_cell(w, &d);
+        dict_get_cell(w, &d);
+    }
+    if (count == 0)
+        return true;
+
+    words = malloc(count * sizeof(compact_word));
+    todo = malloc(count * sizeof(int));
+    if (!words || !todo)
+    {
+        free(words);
+        free(todo);
+        return false;
+    }
+
+    if (entry)
+    {
+        const char *p;
+        zf_addr code;
+        keep[nkeep++] = entry;
+        for (p = uservar_names; *p; p += strlen(p) + 1)
+        {
+            if (find_word(p, &w, &code))
+                keep[nkeep++] = w;
+        }
+    }
+
+    /* Collect words in address order and find the roots of the live set:
+     * the primitives, and the newest word with a given name or the words
+     * to keep for an export */
+
+    zf_addr end = HERE;
+    int i = count;
+    for (w = LATEST; w; w = d)
+    {
+        compact_word *cw = &words[--i];
+        a = w + dict_get_cell(w, &op);
+        a += dict_get_cell(a, &d);
+        cw->hdr = w;
+        cw->name = a;
+        cw->code = a + strlen((const char *)&ctx->mem[a]) + 1;
+        cw->end = end;
+        cw->drop = 0;
+        cw->flags = op;
+        cw->root = (cw->flags & ZF_FLAG_PRIM) != 0;
+        if (!cw->root && entry)
+        {
+            for (int k = 0; k < nkeep; k++)
+                cw->root |= (keep[k] == w);
+        }
+        else if (!cw->root)
+        {
+            int j;
+            for (j = i + 1; j < count; j++)
+            {
+                if (strcmp((const char *)&ctx->mem[a], (const char *)&ctx->mem[words[j].name]) == 0)
+                    break;
+            }
+            cw->root = (j == count);
+        }
+        cw->live = cw->root;
+        if (cw->live)
+            todo[ntodo++] = i;
+        end = w;
+    }
+
+    /* xts kept as data pin their word */
+
+    compact_scan(words, count, 0, HERE, &pin);
+    compact_scan(words, count, ZF_PAD, PAD, &pin);
+    compact_scan(words, count, heap()->bottom, HEAP_META, &pin);
+    compact_scan(words, count, ZF_DSTACK, DSTACK, &pin);
+    compact_scan(words, count, ZF_DATA, ctx->data_here, &pin);
+
+    /* Everything called, ticked, jumped to or referenced by address from a
+     * live word is live as well, and so are the pinned words and those
+     * below them. A literal holding an xt moves the pin up */
+
+    for (;;)
+    {
+        for (i = 0; i <= pin; i++)
+            compact_mark(words, count, todo, &ntodo, words[i].hdr);
+        if (ntodo == 0)
+            break;
+
+        while (ntodo > 0)
+        {
+            compact_word *cw = &words[todo[--ntodo]];
+            zf_addr limit = code_limit(cw->code, cw->flags, cw->end);
+            a = reach = cw->code;
+            while (code_step(&a, limit, &reach, &op, &arg))
+            {
+                if (op >= prim_count)
+                {
+                    compact_mark(words, count, todo, &ntodo, op);
+                }
+                else if (op == PRIM_TICKC || op == PRIM_JMP || op == PRIM_ADDR || op == PRIM_VALUE ||
+                         op == PRIM_TO)
+                {
+                    dict_get_cell(arg, &d);
+                    if (d >= prim_count)
+                        compact_mark(words, count, todo, &ntodo, d);
+                }
+                else if (op == PRIM_LIT)
+                {
+                    dict_get_cell(arg, &d);
+                    int j = compact_xt(words, count, d);
+                    if (j > pin)
+                        pin = j;
+                }
+            }
+        }
+    }
+
+    /* Rank the literal pool again, unless that would move an address out of
+     * the cell holding it or grow the dictionary. The words are then copied
+     * through a buffer, as some of them can move up */
+
+    compact_plan plan, none = {NULL, 0};
+    zf_cell pool[ZF_LIT_POOL_SIZE];
+    uint8_t *out = NULL;
+    int used = compact_pool(words, count, pin, &plan, pool);
+    dest = compact_place(words, count, pin, strip, &plan);
+    if (plan.count > 0 && dest <= HERE && compact_fits(words, count, &plan))
+        out = calloc(1, dest - words[0].hdr);
+    if (!out)
+    {
+        free(plan.lits);
+        plan = none;
+        dest = compact_place(words, count, pin, strip, &plan);
+    }
+
+    /* Rewrite addresses in place, then slide each word down, or copy it to
+     * the buffer. Without new literals addresses only decrease, so the
+     * encoded cells never grow */
+
+    zf_addr prev = 0, len = 0;
+    int k = 0;
+    for (i = 0; i < count; i++)
+    {
+        compact_word *cw = &words[i];
+        if (!cw->live)
+            continue;
+
+        if (cw->drop)
+            dict_patch_cell(cw->hdr, cw->flags | ZF_FLAG_HIDDEN);
+        dict_patch_cell(cw->hdr + dict_get_cell(cw->hdr, &d), prev);
+        prev = cw->dest;
+
+        zf_addr limit = code_limit(cw->code, cw->flags, cw->end);
+        a = reach = cw->code;
+        for (zf_addr at = a; code_step(&a, limit, &reach, &op, &arg); at = a)
+        {
+            if (op >= prim_count)
+            {
+                dict_patch_cell(at, compact_reloc(words, count, &plan, op));
+            }
+            else if (op == PRIM_JMP || op == PRIM_JMP0 || op == PRIM_TICKC || op == PRIM_ADDR ||
+                     op == PRIM_VALUE || op == PRIM_TO)
+            {
+                dict_get_cell(arg, &d);
+                if (d >= prim_count)
+                    dict_patch_cell(arg, compact_reloc(words, count, &plan, d));
+            }
+        }
+
+        if (out)
+        {
+            len = cw->dest - words[0].hdr;
+            if (cw->drop)
+            {
+                len += compact_copy(out + len, cw->hdr, cw->name, &plan, &k);
+                out[len++] = 0;
+                compact_copy(out + len, cw->code, cw->end, &plan, &k);
+            }
+            else
+            {
+                compact_copy(out + len, cw->hdr, cw->end, &plan, &k);
+            }
+        }
+        else if (cw->drop)
+        {
+            zf_addr name = cw->dest + cw->name - cw->hdr;
+            memmove(&ctx->mem[cw->dest], &ctx->mem[cw->hdr], cw->name - cw->hdr);
+            ctx->mem[name] = 0;
+            memmove(&ctx->mem[name + 1], &ctx->mem[cw->code], cw->end - cw->code);
+        }
+        else if (cw->dest != cw->hdr)
+        {
+            memmove(&ctx->mem[cw->dest], &ctx->mem[cw->hdr], cw->end - cw->hdr);
+        }
+    }
+
+    if (out)
+    {
+        memcpy(&ctx->mem[words[0].hdr], out, dest - words[0].hdr);
+        for (k = 0; k < used; k++)
+            cell_store(LIT_POOL + (1 + k) * sizeof(zf_cell), pool[k]);
+        cell_store(LIT_POOL, used);
+        free(out);
+    }
+    free(plan.lits);
+
+    trace("\n=== compact %d bytes", HERE - dest);
+    HERE = dest;
+    LATEST = prev;
+
+    free(words);
+    free(todo);
+    return true;
+}
+
+static void compact(void)
+{
+    if (!compact_words(0, false))
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+}
+
+/*
+ * Tasks. A task is a control block followed by its data and return stacks,
+ * in a block of the PAD heap. The tasks and the interpreter form a ring, and 'pause'
+ * saves the registers of the running task (ip and the stack pointers) and
+ * loads those of the next ready one, so a switch costs a few copies. A task
+ * stops when it returns from the word it was activated in, or aborts.
+ */
+
+#define TASK_STOPPED 0
+#define TASK_READY 1
+#define TASK_HEADER ((sizeof(zf_task) + sizeof(zf_cell) - 1) & ~(sizeof(zf_cell) - 1))
+
+static void task_get(zf_addr t, zf_task *task)
+{
+    if (t == 0)
+        *task = ctx->task0;
+    else
+        memcpy(task, &ctx->mem[t], sizeof(*task));
+}
+
+static void task_put(zf_addr t, const zf_task *task)
+{
+    if (t == 0)
+        ctx->task0 = *task;
+    else
+        memcpy(&ctx->mem[t], task, sizeof(*task));
+}
+
+static void task_reset(void)
+{
+    memset(&ctx->task0, 0, sizeof(ctx->task0));
+    ctx->task0.state = TASK_READY;
+    ctx->task0.s0 = ZF_DSTACK;
+    ctx->task0.r0 = ZF_RSTACK;
+    ctx->task = 0;
+    ctx->s0 = ZF_DSTACK;
+    ctx->r0 = ZF_RSTACK;
+    ctx->handler = 0;
+}
+
+/* Leave the running task in the given state and run the next ready one. The
+ * interpreter is always ready, so there is one */
+
+static void task_switch(zf_addr state)
+{
+    zf_task task;
+    zf_addr t = ctx->task;
+
+    task_get(t, &task);
+    task.state = t == 0 ? TASK_READY : state;
+    task.ip = ctx->ip;
+    task.dsp = DSTACK;
+    task.rsp = RSTACK;
+    task.handler = ctx->handler;
+    task_put(t, &task);
+
+    do
+    {
+        t = task.next;
+        task_get(t, &task);
+    } while (task.state != TASK_READY);
+
+    ctx->task = t;
+    ctx->ip = task.ip;
+    DSTACK = task.dsp;
+    RSTACK = task.rsp;
+    ctx->s0 = task.s0;
+    ctx->r0 = task.r0;
+    ctx->handler = task.handler;
+}
+
+/* Back to the interpreter after an abort, stopping the running task */
+
+static void task_abort(void)
+{
+    zf_task task;
+
+    task_get(ctx->task, &task);
+    task.state = ctx->task == 0 ? TASK_READY : TASK_STOPPED;
+    task_put(ctx->task, &task);
+    ctx->task = 0;
+    ctx->s0 = ZF_DSTACK;
+    ctx->r0 = ZF_RSTACK;
+    ctx->handler = 0;
+}
 
-        ip += l;
+/* Remove task 't' from the ring, before its memory is freed */
+
+static void task_unlink(zf_addr t)
+{
+    zf_task task, next;
+    zf_addr prev = 0;
+
+    if (t == ctx->task)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    task_get(0, &task);
+    while (task.next != 0)
+    {
+        task_get(task.next, &next);
+        if (task.next == t)
+        {
+            task.next = next.next;
+            task_put(prev, &task);
+            return;
+        }
+        prev = task.next;
+        task = next;
+    }
+}
+
+/* Whether a task is paused in the middle of a word. Its ip and return stack
+ * point into the dictionary, so 'compact' waits until all tasks stopped */
+
+static bool tasks_ready(void)
+{
+    zf_task task;
+
+    task_get(0, &task);
+    while (task.next != 0)
+    {
+        task_get(task.next, &task);
+        if (task.state == TASK_READY)
+            return true;
+    }
+    return false;
+}
+
+static zf_addr task_check(zf_addr t)
+{
+    heap_hdr(t);
+    if (t == ctx->task)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    return t;
+}
+
+/*
+ * Exception frames. 'catch' pushes the caller's ip, the data stack pointer,
+ * the enclosing frame and the run() nesting on the return stack, points
+ * ctx->handler at them and calls the word with CATCH_RETURN as its return
+ * address, so 'exit' drops the frame again. A throw, or an abort, unwinds
+ * the return stack to the innermost frame and goes on after its 'catch'.
+ * Only the run() which pushed the frame can go on with it: an abort deeper
+ * down the C stack is caught by the eval() or zf_call() which started that
+ * run(), see catching()
+ */
+
+#define CATCH_RETURN ((zf_addr)-1)
+
+/* run() nesting of the innermost frame, -1 if there is none */
+
+static int catch_depth(void)
+{
+    zf_cell d;
+    if (ctx->handler == 0)
+        return -1;
+    dict_get_cell_typed(ctx->handler + sizeof(zf_cell), &d, ZF_MEM_SIZE_CELL);
+    return d;
+}
+
+/* Drop the innermost frame and go on after its 'catch' with 'code' on the
+ * stack, with the data stack depth of the 'catch' unless 'code' is 0 */
+
+static void catch_pop(zf_cell code)
+{
+    zf_addr dsp;
+
+    RSTACK = ctx->handler;
+    zf_popr();
+    ctx->handler = zf_popr();
+    dsp = zf_popr();
+    ctx->ip = zf_popr();
+    if (code != 0)
+        DSTACK = dsp;
+    zf_push(code);
+}
+
+/* Catch an abort of the run() started at nesting 'run_depth'. An interrupt
+ * can not be caught, it stops the evaluation however it handles errors. A
+ * 'throw' passes its code on in ctx->thrown, so any code can be thrown
+ * without being taken for one of the interpreter */
+
+static bool catching(zf_result r, short run_depth)
+{
+    if (r == ZF_ABORT_INTERRUPT || catch_depth() != run_depth + 1)
+        return false;
+    ctx->run_depth = run_depth;
+    catch_pop(r == ZF_ABORT_THROW ? ctx->thrown : r);
+    return true;
+}
+
+/*
+ * Instruction budget. run() counts down ctx->budget and calls budget_out()
+ * at zero. A sliced evaluation is then suspended: the registers and stacks
+ * stay as they are, and the outermost zf_eval() returns ZF_RUNNING through
+ * its jmpbuf. Nested evaluations and calls can not be suspended, they run on
+ * one instruction at a time until they return.
+ */
+
+/* Tasks are switched, and evaluations suspended, only by the run() of the
+ * outermost evaluation: a nested one returns to its C caller when its ip is
+ * 0, which a task of another nesting level must not reach */
+
+static bool outermost(void)
+{
+    return ctx->run_depth == 1 && ctx->eval_depth == 1;
+}
+
+static void budget_out(void)
+{
+    if (ctx->slicing && outermost())
+    {
+        ctx->suspended = true;
+        longjmp(*ctx->jmp, ZF_RUNNING);
+    }
+    ctx->budget = ctx->slicing ? 1 : UINT32_MAX;
+}
+
+/*
+ * Inner interpreter
+ */
+
+static void run(const char *input)
+{
+    ctx->run_depth++;
+    bool tasks = outermost();
+
+    while (ctx->ip != 0 || (ctx->task != 0 && tasks))
+    {
+        zf_cell d;
+
+        if (ctx->ip == 0)
+        {
+            /* The task returned from the word it was activated in */
+            task_switch(TASK_STOPPED);
+            continue;
+        }
+
+        zf_addr i, ip_org = ctx->ip;
+        zf_addr l = dict_get_cell(ctx->ip, &d);
+        zf_addr code = d;
+
+        trace("\n " ZF_ADDR_FMT " " ZF_ADDR_FMT " ", ctx->ip, code);
+        for (i = 0; i < zf_rstack_count(); i++)
+            trace("┊  ");
+
+        ctx->ip += l;
 
         if (code <= prim_count)
         {
@@ -603,21 +2206,65 @@ static void run(const char *input)
             /* If the prim requests input, restore IP so that the
        * next time around we call the same prim again */
 
-            if (input_state != ZF_INPUT_INTERPRET)
+            if (ctx->input_state != ZF_INPUT_INTERPRET)
             {
-                ip = ip_org;
+                ctx->ip = ip_org;
                 break;
             }
         }
         else
         {
             trace("%s/" ZF_ADDR_FMT " ", op_name(code), code);
-            zf_pushr(ip);
-            ip = code;
+            zf_pushr(ctx->ip);
+            ctx->ip = code;
         }
 
         input = NULL;
+        if (--ctx->budget == 0)
+            budget_out();
+    }
+    ctx->run_depth--;
+}
+
+/*
+ * ['] compiles a primitive as its opcode, so that words like 'if' can ,v it.
+ * Calling such an xt calls the word of the primitive, made by add_prim()
+ */
+
+static zf_addr word_xt(zf_addr xt)
+{
+    zf_cell d;
+
+    if (xt >= prim_count)
+        return xt;
+    if (ctx->prim_xt != 0 && ctx->prim_op == xt && ctx->prim_xt < HERE)
+    {
+        dict_get_cell(ctx->prim_xt, &d);
+        if (d == xt)
+            return ctx->prim_xt;
+    }
+
+    for (zf_addr w = LATEST; w;)
+    {
+        zf_cell link;
+        zf_addr p = w;
+        p += dict_get_cell(p, &d);
+        p += dict_get_cell(p, &link);
+        if ((int)d & ZF_FLAG_PRIM)
+        {
+            p += strlen((const char *)&ctx->mem[p]) + 1;
+            dict_get_cell(p, &d);
+            if (d == xt)
+            {
+                ctx->prim_op = xt;
+                ctx->prim_xt = p;
+                return p;
+            }
+        }
+        w = link;
     }
+    zf_abort(ZF_ABORT_NOT_A_WORD);
+    return 0;
 }
 
 /*
@@ -626,19 +2273,28 @@ static void run(const char *input)
 
 static void execute(zf_addr addr)
 {
-    ip = addr;
-    RSTACK = ZF_RSTACK;
+    zf_addr ip = ctx->ip;
+
+    /* The outermost interpreter starts with an empty return stack, a nested
+     * one keeps the words it was called from */
+    if (ctx->run_depth == 0)
+        RSTACK = ctx->r0;
+    ctx->ip = addr;
     zf_pushr(0);
 
-    trace("\n[%s/" ZF_ADDR_FMT "] ", op_name(ip), ip);
+    trace("\n[%s/" ZF_ADDR_FMT "] ", op_name(ctx->ip), ctx->ip);
     run(NULL);
+
+    /* A prim waiting for input resumes from ip with the next word or char */
+    if (ctx->input_state == ZF_INPUT_INTERPRET)
+        ctx->ip = ip;
 }
 
 static zf_addr peek(zf_addr addr, zf_cell *val, int len)
 {
     if (addr < USERVAR_COUNT)
     {
-        *val = uservar[addr];
+        *val = ctx->uservar[addr];
         return 1;
     }
     else
@@ -713,7 +2369,51 @@ static void do_prim(int op, const char *input)
         &&LABEL_COMPARE,
         &&LABEL_SEARCH,
         &&LABEL_ATOI,
-        &&LABEL_ATOF};
+        &&LABEL_ATOF,
+        &&LABEL_COMPACT,
+        &&LABEL_ALLOCATE,
+        &&LABEL_FREE,
+        &&LABEL_RESIZE,
+        &&LABEL_XALLOT,
+        &&LABEL_XHERE,
+        &&LABEL_XRELEASE,
+        &&LABEL_FETCH,
+        &&LABEL_STORE,
+        &&LABEL_CELL_COMMA,
+        &&LABEL_FETCH_VAR,
+        &&LABEL_STORE_VAR,
+        &&LABEL_COMMA_VAR,
+        &&LABEL_FETCH_U8,
+        &&LABEL_FETCH_S8,
+        &&LABEL_FETCH_U16,
+        &&LABEL_FETCH_S16,
+        &&LABEL_FETCH_U32,
+        &&LABEL_FETCH_S32,
+        &&LABEL_STORE_8,
+        &&LABEL_STORE_16,
+        &&LABEL_STORE_32,
+        &&LABEL_LIT,
+        &&LABEL_PVALUE,
+        &&LABEL_PTO,
+        &&LABEL_PDOES,
+        &&LABEL_CONSTANT,
+        &&LABEL_VALUE,
+        &&LABEL_TO,
+        &&LABEL_DOES,
+        &&LABEL_FILL,
+        &&LABEL_CELL_FILL,
+        &&LABEL_BLOCK,
+        &&LABEL_BUFFER,
+        &&LABEL_UPDATE,
+        &&LABEL_SAVE_BUFFERS,
+        &&LABEL_EMPTY_BUFFERS,
+        &&LABEL_FLUSH,
+        &&LABEL_TASK,
+        &&LABEL_ACTIVATE,
+        &&LABEL_PAUSE,
+        &&LABEL_STOP,
+        &&LABEL_CATCH,
+        &&LABEL_THROW};
 
     if (op >= prim_count)
     {
@@ -724,7 +2424,7 @@ static void do_prim(int op, const char *input)
     goto *labels[op];
 
 LABEL_CELLS:
-    zf_push(zf_pop() * (sizeof(zf_cell) + 1));
+    zf_push(zf_pop() * sizeof(zf_cell));
     return;
 
 LABEL_ABORT:
@@ -734,20 +2434,19 @@ LABEL_ABORT:
 LABEL_CREATE:
     if (input == NULL)
     {
-        input_state = ZF_INPUT_PASS_WORD;
+        ctx->input_state = ZF_INPUT_PASS_WORD;
     }
     else
     {
-        create(input, 0);
-        dict_add_lit(HERE + 4);
-        dict_add_op(PRIM_EXIT);
+        create(input, ZF_FLAG_CREATE);
+        dict_add_data(PRIM_ADDR, 0);
     }
     return;
 
 LABEL_FORGET:
     if (input == NULL)
     {
-        input_state = ZF_INPUT_PASS_WORD;
+        ctx->input_state = ZF_INPUT_PASS_WORD;
     }
     else
     {
@@ -764,10 +2463,11 @@ LABEL_FORGET:
 LABEL_COL:
     if (input == NULL)
     {
-        input_state = ZF_INPUT_PASS_WORD;
+        ctx->input_state = ZF_INPUT_PASS_WORD;
     }
     else
     {
+        txn_begin();
         create(input, 0);
         COMPILING = 1;
     }
@@ -781,15 +2481,18 @@ LABEL_SEMICOL:
     dict_add_op(PRIM_EXIT);
     trace("\n===");
     COMPILING = 0;
+    ctx->txn_open = false;
     return;
 
 LABEL_LIT:
-    ip += dict_get_cell(ip, &d1);
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
     zf_push(d1);
     return;
 
 LABEL_EXIT:
-    ip = zf_popr();
+    ctx->ip = zf_popr();
+    if (ctx->ip == CATCH_RETURN)
+        catch_pop(0);
     return;
 
 LABEL_LEN:
@@ -811,10 +2514,13 @@ LABEL_POKE:
     d1 = zf_pop();
     if (addr < USERVAR_COUNT)
     {
-        uservar[addr] = d1;
+        ctx->uservar[addr] = d1;
         return;
     }
-    dict_put_cell_typed(addr, d1, (zf_mem_size)d2);
+    if ((zf_mem_size)d2 == ZF_MEM_SIZE_VAR)
+        dict_patch_cell(addr, d1);
+    else
+        dict_put_cell_typed(addr, d1, (zf_mem_size)d2);
     return;
 
 LABEL_SWAP:
@@ -905,8 +2611,8 @@ LABEL_ADD:
 
 LABEL_SYS:
     d1 = zf_pop();
-    input_state = zf_host_sys((zf_syscall_id)d1, input);
-    if (input_state != ZF_INPUT_INTERPRET)
+    ctx->input_state = zf_host_sys(ctx, (zf_syscall_id)d1, input);
+    if (ctx->input_state != ZF_INPUT_INTERPRET)
     {
         zf_push(d1); /* re-push id to resume */
     }
@@ -959,24 +2665,24 @@ LABEL_HIDDEN:
     return;
 
 LABEL_JMP:
-    ip += dict_get_cell(ip, &d1);
-    trace("ip " ZF_ADDR_FMT "=>" ZF_ADDR_FMT, ip, (zf_addr)d1);
-    ip = d1;
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
+    trace("ctx->ip " ZF_ADDR_FMT "=>" ZF_ADDR_FMT, ctx->ip, (zf_addr)d1);
+    ctx->ip = d1;
     return;
 
 LABEL_JMP0:
-    ip += dict_get_cell(ip, &d1);
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
     if (zf_pop() == 0)
     {
-        trace("ip " ZF_ADDR_FMT "=>" ZF_ADDR_FMT, ip, (zf_addr)d1);
-        ip = d1;
+        trace("ctx->ip " ZF_ADDR_FMT "=>" ZF_ADDR_FMT, ctx->ip, (zf_addr)d1);
+        ctx->ip = d1;
     }
     return;
 
 LABEL_TICK:
     if (!input)
     {
-        input_state = ZF_INPUT_PASS_WORD;
+        ctx->input_state = ZF_INPUT_PASS_WORD;
         return;
     }
     if (find_word(input, &addr, &xt) == 0)
@@ -985,7 +2691,7 @@ LABEL_TICK:
     return;
 
 LABEL_TICKC:
-    ip += dict_get_cell(ip, &d1);
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
     trace("%s/", op_name(d1));
     zf_push(d1);
     return;
@@ -999,14 +2705,14 @@ LABEL_COMMA:
 LABEL_COMMENT:
     if (!input || input[0] != ')')
     {
-        input_state = ZF_INPUT_PASS_CHAR;
+        ctx->input_state = ZF_INPUT_PASS_CHAR;
     }
     return;
 
 LABEL_COMMENT2:
     if (!input || input[0] != '\n')
     {
-        input_state = ZF_INPUT_PASS_CHAR;
+        ctx->input_state = ZF_INPUT_PASS_CHAR;
     }
     return;
 
@@ -1027,30 +2733,31 @@ LABEL_WORD: // word ( char -- addr )
     if (input == NULL)
     {
         zf_push(PAD);
-        input_state = ZF_INPUT_PASS_CHAR;
+        ctx->input_state = ZF_INPUT_PASS_CHAR;
         return;
     }
 
     char ch = zf_pick(1);
+    pad_check(1);
     if (input[0] == ch || input[0] == '\n' || input[0] == 0)
     {
-        mem[PAD++] = 0;
+        PAD += dict_put_bytes(PAD, "", 1);
         zf_addr addr = zf_pop();
         zf_pop();
         zf_push(addr);
     }
     else
     {
-        mem[PAD++] = input[0];
-        input_state = ZF_INPUT_PASS_CHAR;
+        PAD += dict_put_bytes(PAD, input, 1);
+        ctx->input_state = ZF_INPUT_PASS_CHAR;
     }
 }
     return;
 
 LABEL_LITS:
-    ip += dict_get_cell(ip, &d1);
-    zf_push(ip);
-    ip += d1;
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
+    zf_push(ctx->ip);
+    ctx->ip += d1;
     return;
 
 LABEL_AND:
@@ -1070,11 +2777,11 @@ LABEL_STR:
         {
             zf_push(PAD);
         }
-        input_state = ZF_INPUT_PASS_CHAR;
+        ctx->input_state = ZF_INPUT_PASS_CHAR;
         return;
     }
 
-    if (COMPILING && input[0] == '"' && mem[HERE - 1] != '\\')
+    if (COMPILING && input[0] == '"' && ctx->mem[HERE - 1] != '\\')
     {
         addr = zf_pop();
         len = HERE - addr;
@@ -1083,7 +2790,7 @@ LABEL_STR:
         return;
     }
 
-    if (!COMPILING && input[0] == '"' && mem[PAD - 1] != '\\')
+    if (!COMPILING && input[0] == '"' && ctx->mem[PAD - 1] != '\\')
     {
         addr = zf_pick(0);
         len = PAD - addr;
@@ -1093,24 +2800,16 @@ LABEL_STR:
 
     if (COMPILING)
     {
-        if (HERE >= ZF_DICT_SIZE)
+        if (HERE >= DICT_SIZE)
             zf_abort(ZF_ABORT_OUTSIDE_DICT);
-        mem[HERE++] = input[0];
+        HERE += dict_put_bytes(HERE, input, 1);
     }
     else
     {
-        if (PAD >= (ZF_PAD + ZF_PAD_SIZE - 2))
-        {
-            zf_addr addr = zf_pop();
-            size_t len = PAD - addr;
-            PAD = ZF_PAD;
-            zf_push(PAD);
-            memcpy(&mem[PAD], &mem[addr], len);
-            PAD += len;
-        }
-        mem[PAD++] = input[0];
+        pad_check(1);
+        PAD += dict_put_bytes(PAD, input, 1);
     }
-    input_state = ZF_INPUT_PASS_CHAR;
+    ctx->input_state = ZF_INPUT_PASS_CHAR;
     return;
 
 LABEL_CMOVE:
@@ -1118,20 +2817,25 @@ LABEL_CMOVE:
     size_t len = zf_pop();
     zf_addr dst = zf_pop();
     zf_addr src = zf_pop();
-    memmove(&mem[dst], &mem[src], len);
+    CHECK(len <= ZF_MEMORY_SIZE && dst <= ZF_MEMORY_SIZE - len && src <= ZF_MEMORY_SIZE - len,
+          ZF_ABORT_OUTSIDE_MEM);
+    SNAP_KEEP(dst, len);
+    memmove(&ctx->mem[dst], &ctx->mem[src], len);
     // mem[dst + len] = 0;
 }
     return;
 
 LABEL_EXECUTE:
-    addr = zf_pop();
-    execute(addr);
+    /* Call the word like run() does, so the caller continues afterwards */
+    addr = word_xt(zf_pop());
+    zf_pushr(ctx->ip);
+    ctx->ip = addr;
     return;
 
 LABEL_CHAR:
     if (input == NULL)
     {
-        input_state = ZF_INPUT_PASS_WORD;
+        ctx->input_state = ZF_INPUT_PASS_WORD;
         return;
     }
     zf_push(input[0]);
@@ -1145,7 +2849,7 @@ LABEL_WORDS:
         p += dict_get_cell(word, &d);
         p += dict_get_cell(p, &link);
         if (!((int)d & ZF_FLAG_HIDDEN))
-            zf_host_print("%s ", (const char *)&mem[p]);
+            zf_host_print("%s ", (const char *)&ctx->mem[p]);
         word = link;
     }
     return;
@@ -1153,7 +2857,7 @@ LABEL_WORDS:
 LABEL_SEE:
     if (input == NULL)
     {
-        input_state = ZF_INPUT_PASS_WORD;
+        ctx->input_state = ZF_INPUT_PASS_WORD;
         return;
     }
     zf_disassemble(input);
@@ -1162,8 +2866,7 @@ LABEL_SEE:
 LABEL_ALLOC:
 {
     size_t size = zf_pop();
-    if (PAD + size + 1 >= (ZF_PAD + ZF_PAD_SIZE))
-        PAD = ZF_PAD;
+    pad_check(size + 1);
     zf_push(PAD);
     PAD += size + 1;
 }
@@ -1180,8 +2883,8 @@ LABEL_COMPARE:
         zf_push((int)(len1 - len2));
         return;
     }
-    const char *str1 = (const char *)&mem[addr1];
-    const char *str2 = (const char *)&mem[addr2];
+    const char *str1 = (const char *)&ctx->mem[addr1];
+    const char *str2 = (const char *)&ctx->mem[addr2];
     zf_push(strncmp(str1, str2, len1));
     return;
 }
@@ -1198,9 +2901,9 @@ LABEL_SEARCH:
         return;
     }
     int i = 0;
-    for (const char *p = (const char *)&mem[addr2]; i <= (len2 - len1); p++, i++)
+    for (const char *p = (const char *)&ctx->mem[addr2]; i <= (len2 - len1); p++, i++)
     {
-        if (strncmp(p, (const char *)&mem[addr1], len1) == 0)
+        if (strncmp(p, (const char *)&ctx->mem[addr1], len1) == 0)
         {
             zf_push(i + 1);
             return;
@@ -1220,19 +2923,366 @@ LABEL_ATOI:
     strncpy(str, p, len > 31 ? 31 : len);
     zf_push(atol(str));
     return;
-}
+}
+
+LABEL_ATOF:
+{
+    size_t len = zf_pop();
+    const char *p = (const char *)(zf_dump(NULL) + (int)zf_pop());
+    if (len == 0)
+        len = strlen(p);
+    char str[32];
+    strncpy(str, p, len > 31 ? 31 : len);
+    zf_push(atof(str));
+    return;
+}
+
+LABEL_COMPACT:
+    ctx->compact_pending = true;
+    return;
+
+LABEL_ALLOCATE: // allocate ( size -- addr )
+    zf_push(heap_alloc(zf_pop()));
+    return;
+
+LABEL_FREE: // free ( addr -- )
+    addr = zf_pop();
+    if (addr)
+    {
+        task_unlink(addr);
+        heap_free(addr);
+    }
+    return;
+
+LABEL_RESIZE: // resize ( addr size -- addr )
+{
+    size_t size = zf_pop();
+    addr = zf_pop();
+    zf_push(addr ? heap_resize(addr, size) : heap_alloc(size));
+}
+    return;
+
+LABEL_XALLOT: // xallot ( size -- addr )
+{
+    size_t size = zf_pop();
+    size = (size + sizeof(zf_cell) - 1) & ~(sizeof(zf_cell) - 1);
+    if (size > ZF_DATA + DATA_SIZE - ctx->data_here)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    zf_push(ctx->data_here);
+    ctx->data_here += size;
+}
+    return;
+
+LABEL_XHERE: // xhere ( -- addr )
+    zf_push(ctx->data_here);
+    return;
+
+LABEL_XRELEASE: // xrelease ( addr -- )
+    addr = zf_pop();
+    if (addr < ZF_DATA || addr > ctx->data_here)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    ctx->data_here = addr;
+    return;
+
+    /* Direct memory access for each width. User variables are only reached
+     * through whole cells */
+
+#define LOAD(t)                                                  \
+    {                                                            \
+        t v;                                                     \
+        addr = zf_pop();                                         \
+        CHECK(addr <= ZF_MEMORY_SIZE - sizeof(t), ZF_ABORT_OUTSIDE_MEM); \
+        memcpy(&v, &ctx->mem[addr], sizeof(t));                       \
+        zf_push(v);                                              \
+    }
+
+#define STORE(t)                                                 \
+    {                                                            \
+        addr = zf_pop();                                         \
+        t v = (t)(int64_t)zf_pop();                              \
+        CHECK(addr <= ZF_MEMORY_SIZE - sizeof(t), ZF_ABORT_OUTSIDE_MEM); \
+        SNAP_KEEP(addr, sizeof(t));                              \
+        memcpy(&ctx->mem[addr], &v, sizeof(t));                       \
+    }
+
+LABEL_FETCH: // @ ( addr -- v )
+    addr = zf_pop();
+    zf_push(addr < USERVAR_COUNT ? ctx->uservar[addr] : cell_load(addr));
+    return;
+
+LABEL_STORE: // ! ( v addr -- )
+    addr = zf_pop();
+    d1 = zf_pop();
+    if (addr < USERVAR_COUNT)
+        ctx->uservar[addr] = d1;
+    else
+        cell_store(addr, d1);
+    return;
+
+LABEL_CELL_COMMA: // , ( v -- )
+    if (HERE > DICT_SIZE - sizeof(zf_cell))
+        zf_abort(ZF_ABORT_OUTSIDE_DICT);
+    cell_store(HERE, zf_pop());
+    HERE += sizeof(zf_cell);
+    return;
+
+LABEL_FETCH_VAR: // @v ( addr -- v )
+    dict_get_cell(zf_pop(), &d1);
+    zf_push(d1);
+    return;
+
+LABEL_STORE_VAR: // !v ( v addr -- )
+    addr = zf_pop();
+    dict_patch_cell(addr, zf_pop());
+    return;
+
+LABEL_COMMA_VAR: // ,v ( v -- )
+    dict_add_cell(zf_pop());
+    return;
+
+LABEL_FETCH_U8:
+    LOAD(uint8_t);
+    return;
+
+LABEL_FETCH_S8:
+    LOAD(int8_t);
+    return;
+
+LABEL_FETCH_U16:
+    LOAD(uint16_t);
+    return;
+
+LABEL_FETCH_S16:
+    LOAD(int16_t);
+    return;
+
+LABEL_FETCH_U32:
+    LOAD(uint32_t);
+    return;
+
+LABEL_FETCH_S32:
+    LOAD(int32_t);
+    return;
+
+LABEL_STORE_8:
+    STORE(uint8_t);
+    return;
+
+LABEL_STORE_16:
+    STORE(uint16_t);
+    return;
+
+LABEL_STORE_32:
+    STORE(uint32_t);
+    return;
+
+LABEL_PVALUE:
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
+    zf_push(cell_load(d1));
+    return;
+
+LABEL_PTO:
+    ctx->ip += dict_get_cell(ctx->ip, &d1);
+    cell_store(d1, zf_pop());
+    return;
+
+LABEL_PDOES: // make the latest 'create' word jump to the code after (does)
+{
+    zf_addr code = LATEST;
+    code += dict_get_cell(code, &d1);
+    if (!((int)d1 & ZF_FLAG_CREATE))
+        zf_abort(ZF_ABORT_INTERNAL_ERROR);
+    code += dict_get_cell(code, &d1);
+    code += strlen((const char *)&ctx->mem[code]) + 1;
+    code += dict_get_cell(code, &d1);
+    if (d1 != PRIM_ADDR)
+        zf_abort(ZF_ABORT_INTERNAL_ERROR);
+    code += dict_get_cell(code, &d1);
+    SNAP_KEEP(code, 1);
+    ctx->mem[code] = PRIM_JMP;
+    dict_patch_cell(code + 1, ctx->ip);
+    ctx->ip = zf_popr();
+}
+    return;
+
+LABEL_CONSTANT: // constant ( v "name" -- )
+    if (input == NULL)
+    {
+        ctx->input_state = ZF_INPUT_PASS_WORD;
+        return;
+    }
+    create(input, ZF_FLAG_CONST);
+    dict_add_lit(zf_pop());
+    dict_add_op(PRIM_EXIT);
+    return;
+
+LABEL_VALUE: // value ( v "name" -- )
+    if (input == NULL)
+    {
+        ctx->input_state = ZF_INPUT_PASS_WORD;
+        return;
+    }
+    create(input, ZF_FLAG_CREATE);
+    dict_add_data(PRIM_VALUE, sizeof(zf_cell));
+    cell_store(HERE, zf_pop());
+    HERE += sizeof(zf_cell);
+    return;
+
+LABEL_TO: // to ( v "name" -- )
+{
+    zf_addr w, code;
+    if (input == NULL)
+    {
+        ctx->input_state = ZF_INPUT_PASS_WORD;
+        return;
+    }
+    if (!find_word(input, &w, &code))
+        zf_abort(ZF_ABORT_NOT_A_WORD);
+    code += dict_get_cell(code, &d1);
+    if (d1 != PRIM_VALUE)
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    dict_get_cell(code, &d1);
+    if (COMPILING)
+    {
+        dict_add_op(PRIM_TO);
+        dict_add_cell(d1);
+    }
+    else
+    {
+        cell_store(d1, zf_pop());
+    }
+}
+    return;
+
+LABEL_DOES:
+    dict_add_op(PRIM_DOES);
+    return;
+
+LABEL_FILL: // fill ( addr len c -- )
+{
+    uint8_t c = zf_pop();
+    size_t len = zf_pop();
+    addr = zf_pop();
+    CHECK(len <= ZF_MEMORY_SIZE && addr <= ZF_MEMORY_SIZE - len, ZF_ABORT_OUTSIDE_MEM);
+    SNAP_KEEP(addr, len);
+    memset(&ctx->mem[addr], c, len);
+}
+    return;
+
+LABEL_CELL_FILL: // cell-fill ( addr n v -- ), the copy doubles each step
+{
+    zf_cell v = zf_pop();
+    size_t len = zf_pop() * sizeof(zf_cell);
+    addr = zf_pop();
+    CHECK(len <= ZF_MEMORY_SIZE && addr <= ZF_MEMORY_SIZE - len, ZF_ABORT_OUTSIDE_MEM);
+    if (len == 0)
+        return;
+    SNAP_KEEP(addr, len);
+    memcpy(&ctx->mem[addr], &v, sizeof(v));
+    for (size_t done = sizeof(v); done < len; done *= 2)
+        memcpy(&ctx->mem[addr + done], &ctx->mem[addr], done < len - done ? done : len - done);
+}
+    return;
+
+LABEL_BLOCK: // block ( u -- addr )
+    zf_push(block_get(zf_pop(), true));
+    return;
+
+LABEL_BUFFER: // buffer ( u -- addr ), without reading the block
+    zf_push(block_get(zf_pop(), false));
+    return;
+
+LABEL_UPDATE:
+    if (ctx->block_cur >= 0)
+        ctx->block_bufs[ctx->block_cur].dirty = true;
+    return;
+
+LABEL_SAVE_BUFFERS:
+    block_save();
+    return;
+
+LABEL_EMPTY_BUFFERS:
+    block_reset();
+    return;
+
+LABEL_FLUSH:
+    block_save();
+    block_reset();
+    return;
+
+LABEL_TASK: // task ( size -- t ), with 'size' bytes for its stacks
+{
+    zf_task task, task0;
+    size_t size = ((size_t)zf_pop() + sizeof(zf_cell) - 1) & ~(sizeof(zf_cell) - 1);
+    if (size < 2 * sizeof(zf_cell))
+        zf_abort(ZF_ABORT_INVALID_SIZE);
+    addr = heap_alloc(TASK_HEADER + size);
+    task_get(0, &task0);
+    task.next = task0.next;
+    task.state = TASK_STOPPED;
+    task.ip = 0;
+    task.handler = 0;
+    task.s0 = task.dsp = addr + TASK_HEADER;
+    task.r0 = task.rsp = addr + TASK_HEADER + size - sizeof(zf_cell);
+    task_put(addr, &task);
+    task0.next = addr;
+    task_put(0, &task0);
+    zf_push(addr);
+}
+    return;
+
+LABEL_ACTIVATE: // activate ( t -- ), the rest of the calling word runs in task t
+{
+    zf_task task;
+    addr = task_check(zf_pop());
+    task_get(addr, &task);
+    task.state = TASK_READY;
+    task.ip = ctx->ip;
+    task.dsp = task.s0;
+    task.rsp = task.r0 - sizeof(zf_cell);
+    task.handler = 0;
+    dict_put_cell_typed(task.r0, 0, ZF_MEM_SIZE_CELL);
+    task_put(addr, &task);
+    ctx->ip = zf_popr();
+}
+    return;
+
+LABEL_PAUSE:
+    if (outermost())
+        task_switch(TASK_READY);
+    return;
+
+LABEL_STOP:
+    if (outermost())
+        task_switch(TASK_STOPPED);
+    return;
 
-LABEL_ATOF:
-{
-    size_t len = zf_pop();
-    const char *p = (const char *)(zf_dump(NULL) + (int)zf_pop());
-    if (len == 0)
-        len = strlen(p);
-    char str[32];
-    strncpy(str, p, len > 31 ? 31 : len);
-    zf_push(atof(str));
+LABEL_CATCH: // catch ( i*x xt -- j*x 0 | i*x n )
+    addr = word_xt(zf_pop());
+    zf_pushr(ctx->ip);
+    zf_pushr(DSTACK);
+    zf_pushr(ctx->handler);
+    zf_pushr(ctx->run_depth);
+    ctx->handler = RSTACK;
+    zf_pushr(CATCH_RETURN);
+    ctx->ip = addr;
+    return;
+
+LABEL_THROW: // throw ( k*x n -- k*x | i*x n )
+    d1 = zf_pop();
+    if (d1 != 0)
+    {
+        if (catch_depth() == ctx->run_depth)
+        {
+            catch_pop(d1);
+        }
+        else
+        {
+            ctx->thrown = d1;
+            zf_abort(ZF_ABORT_THROW);
+        }
+    }
     return;
-}
 }
 
 /*
@@ -1248,9 +3298,9 @@ static void handle_word(const char *buf)
     /* If a word was requested by an earlier operation, resume with the new
    * word */
 
-    if (input_state == ZF_INPUT_PASS_WORD)
+    if (ctx->input_state == ZF_INPUT_PASS_WORD)
     {
-        input_state = ZF_INPUT_INTERPRET;
+        ctx->input_state = ZF_INPUT_INTERPRET;
         run(buf);
         return;
     }
@@ -1275,11 +3325,17 @@ static void handle_word(const char *buf)
             {
                 dict_get_cell(code, &d);
                 dict_add_op(d);
+                if (d == PRIM_TICKC)
+                    ctx->tick_here = HERE;
             }
-            else
+            else if (HERE == ctx->tick_here)
             {
                 dict_add_op(code);
             }
+            else
+            {
+                dict_add_ref(code, flags);
+            }
             POSTPONE = 0;
         }
         else
@@ -1292,7 +3348,7 @@ static void handle_word(const char *buf)
         /* Word not found: try to convert to a number and compile or push, depending
      * on state */
 
-        zf_cell v = zf_host_parse_num(buf);
+        zf_cell v = zf_host_parse_num(ctx, buf);
 
         if (COMPILING)
         {
@@ -1312,31 +3368,30 @@ static void handle_word(const char *buf)
 
 static void handle_char(char c)
 {
-    static char buf[32];
-    static size_t len = 0;
+    char *buf = ctx->word;
 
-    if (input_state == ZF_INPUT_PASS_CHAR)
+    if (ctx->input_state == ZF_INPUT_PASS_CHAR)
     {
-        input_state = ZF_INPUT_INTERPRET;
+        ctx->input_state = ZF_INPUT_INTERPRET;
         run(&c);
     }
-    else if (c == '"' && len == 0) // To use conventional string syntax
+    else if (c == '"' && ctx->word_len == 0) // To use conventional string syntax
     {
         handle_word("s\"");
     }
     else if (c != '\0' && !isspace(c))
     {
-        if (len < sizeof(buf) - 1)
+        if (ctx->word_len < sizeof(ctx->word) - 1)
         {
-            buf[len++] = c;
-            buf[len] = '\0';
+            buf[ctx->word_len++] = c;
+            buf[ctx->word_len] = '\0';
         }
     }
     else
     {
-        if (len > 0)
+        if (ctx->word_len > 0)
         {
-            len = 0;
+            ctx->word_len = 0;
             handle_word(buf);
         }
     }
@@ -1346,18 +3401,233 @@ static void handle_char(char c)
  * Initialisation
  */
 
-void zf_init(int enable_trace)
+/*
+ * With dynamic memory the whole block is reserved as address space, the
+ * system only commits the pages which get touched, so a large dictionary or
+ * PAD costs nothing until it is used
+ */
+
+static uint8_t *mem_alloc(size_t len)
+{
+#if ZF_ENABLE_DYNAMIC_MEM
+    void *p = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    return p == MAP_FAILED ? NULL : (uint8_t *)p;
+#else
+    return malloc(len);
+#endif
+}
+
+static void mem_free(void)
+{
+    if (ctx->mem && !ctx->mem_mapped)
+    {
+#if ZF_ENABLE_DYNAMIC_MEM
+        munmap(ctx->mem, ZF_MEMORY_SIZE);
+#else
+        free(ctx->mem);
+#endif
+    }
+    ctx->mem = NULL;
+    ctx->mem_mapped = false;
+}
+
+zf_result zf_init(int enable_trace, zf_addr dict, zf_addr pad, zf_addr stack, zf_addr data)
 {
-    if (!mem)
-        mem = malloc(ZF_MEMORY_SIZE);
-    uservar = (zf_addr *)mem;
-    HERE = USERVAR_COUNT * sizeof(zf_addr);
+#if ZF_ENABLE_DYNAMIC_MEM
+    dict = dict ? dict : ZF_DICT_SIZE;
+    pad = pad ? pad : ZF_PAD_SIZE;
+    stack = stack ? stack : ZF_STACK_SIZE;
+    if (dict < LIT_POOL_END || pad < 2 * sizeof(heap_meta) || stack < 2 * sizeof(zf_cell) ||
+        (uint64_t)dict + pad + stack + data + sizeof(zf_cell) > (zf_addr)-1)
+        return ZF_ABORT_INVALID_SIZE;
+    if (dict != DICT_SIZE || pad != PAD_SIZE || stack != STACK_SIZE || data != DATA_SIZE)
+    {
+        mem_free();
+        ctx->dict_size = dict;
+        ctx->pad_size = pad;
+        ctx->stack_size = stack;
+        ctx->data_size = data;
+    }
+#else
+    (void)dict;
+    (void)pad;
+    (void)stack;
+    (void)data;
+#endif
+    if (!ctx->mem)
+        ctx->mem = mem_alloc(ZF_MEMORY_SIZE);
+    if (!ctx->mem)
+        return ZF_ABORT_OUTSIDE_MEM;
+    ctx->uservar = (zf_addr *)ctx->mem;
+    HERE = LIT_POOL_END;
+    cell_store(LIT_POOL, 0);
+    ctx->txn_open = false;
+    block_reset();
     TRACE = enable_trace;
     LATEST = 0;
     PAD = ZF_PAD;
     DSTACK = ZF_DSTACK;
     RSTACK = ZF_RSTACK;
     COMPILING = 0;
+    heap_init();
+    task_reset();
+    ctx->data_here = ZF_DATA;
+    return ZF_OK;
+}
+
+/*
+ * Contexts. A new context is initialized like zf_init() does for the
+ * built-in one, and is only used once selected, or through zf_ctx_eval()
+ */
+
+zf_ctx *zf_ctx_new(int trace, zf_addr dict, zf_addr pad, zf_addr stack, zf_addr data)
+{
+    zf_ctx *c = calloc(1, sizeof(*c));
+    if (c == NULL)
+        return NULL;
+    zf_ctx *prev = zf_ctx_select(c);
+    zf_result r = zf_init(trace, dict, pad, stack, data);
+    zf_ctx_select(prev);
+    if (r != ZF_OK)
+    {
+        zf_ctx_free(c);
+        return NULL;
+    }
+    return c;
+}
+
+/*
+ * Shared dictionaries. zf_ctx_share() freezes the dictionary of a context,
+ * typically after loading the core words, and zf_ctx_spawn() makes contexts
+ * which start with it. With dynamic memory the frozen dictionary is a
+ * shared memory file, mapped copy-on-write at the start of each spawned
+ * context: the instances share its pages, and only the pages they write to,
+ * like the one with the user variables, become private. Otherwise it is
+ * copied from the sharing context, which must then stay unchanged. The PAD,
+ * heap and stacks of a spawned context start empty.
+ */
+
+zf_result zf_ctx_share(zf_ctx *c)
+{
+    zf_ctx *prev = zf_ctx_select(c);
+    zf_addr len = HERE;
+#if ZF_ENABLE_DYNAMIC_MEM
+    char name[64];
+    static unsigned int seq;
+    int fd;
+
+    snprintf(name, sizeof(name), "/zforth-%d-%u", (int)getpid(), __atomic_fetch_add(&seq, 1, __ATOMIC_RELAXED));
+    fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+    if (fd >= 0)
+        shm_unlink(name);
+    if (fd < 0 || ftruncate(fd, len) != 0 || write(fd, ctx->mem, len) != (ssize_t)len)
+    {
+        if (fd >= 0)
+            close(fd);
+        zf_ctx_select(prev);
+        return ZF_ABORT_OUTSIDE_MEM;
+    }
+    if (ctx->shared_len)
+        close(ctx->shared_fd);
+    ctx->shared_fd = fd;
+#endif
+    ctx->shared_len = len;
+    zf_ctx_select(prev);
+    return ZF_OK;
+}
+
+zf_ctx *zf_ctx_spawn(zf_ctx *core)
+{
+    zf_ctx *c;
+    zf_addr len = core->shared_len;
+
+    if (len == 0 || (c = calloc(1, sizeof(*c))) == NULL)
+        return NULL;
+    zf_ctx *prev = zf_ctx_select(c);
+#if ZF_ENABLE_DYNAMIC_MEM
+    c->dict_size = core->dict_size;
+    c->pad_size = core->pad_size;
+    c->stack_size = core->stack_size;
+    c->data_size = core->data_size;
+    c->mem = mem_alloc(ZF_MEMORY_SIZE);
+    if (c->mem &&
+        mmap(c->mem, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, core->shared_fd, 0) == MAP_FAILED)
+        mem_free();
+#else
+    c->mem = mem_alloc(ZF_MEMORY_SIZE);
+    if (c->mem)
+        memcpy(c->mem, core->mem, len);
+#endif
+    if (c->mem == NULL)
+    {
+        zf_ctx_select(prev);
+        free(c);
+        return NULL;
+    }
+    c->uservar = (zf_addr *)c->mem;
+    COMPILING = 0;
+    POSTPONE = 0;
+    PAD = ZF_PAD;
+    DSTACK = ZF_DSTACK;
+    RSTACK = ZF_RSTACK;
+    heap_init();
+    c->data_here = ZF_DATA;
+    task_reset();
+    block_reset();
+    zf_ctx_select(prev);
+    return c;
+}
+
+void zf_ctx_free(zf_ctx *c)
+{
+    zf_ctx *prev = zf_ctx_select(c);
+    mem_free();
+#if ZF_ENABLE_DYNAMIC_MEM
+    if (c->shared_len)
+        close(c->shared_fd);
+#endif
+    c->shared_len = 0;
+    zf_ctx_select(prev == c ? NULL : prev);
+    if (c != &ctx_default)
+        free(c);
+}
+
+/* Select the context the calling thread works on, NULL for the built-in one.
+ * Returns the previous one */
+
+zf_ctx *zf_ctx_select(zf_ctx *c)
+{
+    zf_ctx *prev = ctx;
+    ctx = c ? c : &ctx_default;
+    return prev;
+}
+
+zf_ctx *zf_ctx_current(void)
+{
+    return ctx;
+}
+
+zf_result zf_ctx_eval(zf_ctx *c, const char *buf)
+{
+    zf_ctx *prev = zf_ctx_select(c);
+    zf_result r = zf_eval(buf);
+    zf_ctx_select(prev);
+    return r;
+}
+
+void zf_ctx_push(zf_ctx *c, zf_cell v)
+{
+    zf_ctx *prev = zf_ctx_select(c);
+    zf_push(v);
+    zf_ctx_select(prev);
+}
+
+zf_cell zf_ctx_pop(zf_ctx *c)
+{
+    zf_ctx *prev = zf_ctx_select(c);
+    zf_cell v = zf_pop();
+    zf_ctx_select(prev);
+    return v;
 }
 
 #if ZF_ENABLE_BOOTSTRAP
@@ -1406,6 +3676,10 @@ void zf_bootstrap(void)
     {
         add_prim(prim_names[i], i);
     }
+    for (int i = 0; i < sizeof(prim_aliases) / sizeof(prim_aliases[0]); i++)
+    {
+        add_prim(prim_aliases[i].name, prim_aliases[i].op);
+    }
 
     zf_addr i = 0;
     const char *p;
@@ -1425,51 +3699,617 @@ void zf_bootstrap(void)
  * Eval forth string
  */
 
-zf_result zf_eval(const char *buf)
+/* Handle the characters of 'buf'. With 'resume' the first one was handled
+ * already, by the word which was suspended or caught an abort */
+
+static void interpret(const char *buf, bool resume)
+{
+    for (;;)
+    {
+        if (!resume)
+        {
+            ctx->eval_pos = buf;
+            handle_char(*buf);
+        }
+        resume = false;
+        if (*buf == '\0')
+            break;
+        buf++;
+    }
+    if (ctx->eval_depth == 1 && ctx->compact_pending && !COMPILING &&
+        ctx->input_state == ZF_INPUT_INTERPRET && !ctx->snap && !tasks_ready())
+    {
+        ctx->compact_pending = false;
+        compact();
+    }
+}
+
+static zf_result eval(const char *buf, bool resume)
 {
-    static short cpt = 0;
-    zf_result r = ZF_OK;
+    zf_result r;
+    jmp_buf jmp, *outer = ctx->jmp;
+    const char *eval_pos = ctx->eval_pos;
+    short eval_depth = ctx->eval_depth++;
+
+    /* Called from a word through zf_call(), the state of the word is kept */
+    short run_depth = ctx->run_depth;
+    zf_addr ip = ctx->ip, dsp = DSTACK, rsp = RSTACK, handler = ctx->handler;
 
-    if (cpt++ == 0)
-        r = (zf_result)setjmp(jmpbuf);
+    ctx->jmp = &jmp;
+    r = (zf_result)setjmp(jmp);
 
     if (r == ZF_OK)
     {
-        for (;;)
+        if (resume)
         {
-            handle_char(*buf);
-            if (*buf == '\0')
+            ctx->suspended = false;
+            if (ctx->cancel)
             {
-                cpt--;
-                return ZF_OK;
+                ctx->cancel = false;
+                zf_abort(ZF_ABORT_INTERRUPT);
             }
-            buf++;
+            run(NULL);
+            buf = ctx->eval_pos;
         }
+        interpret(buf, resume);
+    }
+    else if (r == ZF_RUNNING)
+    {
+        ctx->eval_depth = 0;
+        ctx->run_depth = 0;
+        ctx->jmp = outer;
+        return r;
+    }
+    else if (catching(r, run_depth))
+    {
+        /* The word goes on after its 'catch', and the evaluation after it */
+        ctx->eval_depth = eval_depth + 1;
+        run(NULL);
+        if (run_depth > 0 && ctx->input_state == ZF_INPUT_INTERPRET)
+            ctx->ip = ip;
+        interpret(ctx->eval_pos, true);
+        r = ZF_OK;
+    }
+    else if (eval_depth > 0)
+    {
+        /* Pass the abort on to the evaluation or call around this one */
+        ctx->eval_depth = eval_depth;
+        ctx->run_depth = run_depth;
+        ctx->eval_pos = eval_pos;
+        ctx->jmp = outer;
+        zf_abort(r);
     }
     else
     {
+        txn_rollback();
         COMPILING = 0;
-        RSTACK = ZF_RSTACK;
-        DSTACK = ZF_DSTACK;
-        cpt--;
-        return r;
+        if (run_depth == 0)
+        {
+            task_abort();
+            RSTACK = ZF_RSTACK;
+            DSTACK = ZF_DSTACK;
+        }
+        else
+        {
+            ctx->ip = ip;
+            RSTACK = rsp;
+            DSTACK = dsp;
+            ctx->handler = handler;
+        }
+        ctx->run_depth = run_depth;
+        ctx->suspended = false;
+    }
+
+    ctx->eval_depth = eval_depth;
+    ctx->eval_pos = eval_pos;
+    ctx->jmp = outer;
+    if (eval_depth == 0)
+        pad_release();
+    return r;
+}
+
+zf_result zf_eval(const char *buf)
+{
+    if (ctx->eval_depth == 0)
+    {
+        ctx->slicing = false;
+        ctx->budget = UINT32_MAX;
+    }
+    return eval(buf, false);
+}
+
+/* Evaluate like zf_eval(), but return ZF_RUNNING after 'budget' instructions,
+ * and go on with zf_run_slice() or give up with zf_run_cancel(). 'buf' must be
+ * kept until the evaluation is done. Called from a word, it evaluates the
+ * whole string at once */
+
+zf_result zf_eval_slice(const char *buf, uint32_t budget)
+{
+    if (ctx->eval_depth > 0)
+        return zf_eval(buf);
+    ctx->slicing = true;
+    ctx->budget = budget ? budget : 1;
+    return eval(buf, false);
+}
+
+zf_result zf_run_slice(uint32_t budget)
+{
+    if (!ctx->suspended)
+        return ZF_OK;
+    ctx->budget = budget ? budget : 1;
+    return eval(NULL, true);
+}
+
+/* Call the word at 'xt' with the data stack as it is, from the host, also
+ * while the interpreter runs, for instance in zf_host_sys(), or while a
+ * sliced evaluation is suspended. The return stack and ip of the running or
+ * suspended code are kept, and its catch frames do not catch aborts of the
+ * call. An abort which the word does not catch returns its reason, with the
+ * data stack pointer back where it was before the call */
+
+zf_result zf_call(zf_addr xt)
+{
+    jmp_buf jmp, *outer = ctx->jmp;
+    zf_addr ip = ctx->ip, dsp = DSTACK, rsp = RSTACK, handler = ctx->handler;
+    short eval_depth = ctx->eval_depth, run_depth = ctx->run_depth;
+    zf_result r;
+
+    ctx->jmp = &jmp;
+    r = (zf_result)setjmp(jmp);
+    if (r == ZF_OK)
+    {
+        if (run_depth == 0 && eval_depth == 0 && !ctx->suspended)
+            RSTACK = ctx->r0;
+        if (ctx->suspended)
+            ctx->handler = 0;
+        ctx->ip = word_xt(xt);
+        zf_pushr(0);
+        run(NULL);
+    }
+    else if (catching(r, run_depth))
+    {
+        ctx->eval_depth = eval_depth;
+        run(NULL);
+        r = ZF_OK;
+    }
+    else
+    {
+        DSTACK = dsp;
+        ctx->eval_depth = eval_depth;
+        ctx->run_depth = run_depth;
+    }
+    RSTACK = rsp;
+    ctx->ip = ip;
+    ctx->handler = handler;
+    ctx->jmp = outer;
+    return r;
+}
+
+/* Abort a suspended evaluation, as if it was interrupted */
+
+zf_result zf_run_cancel(void)
+{
+    if (!ctx->suspended)
+        return ZF_OK;
+    ctx->cancel = true;
+    return eval(NULL, true);
+}
+
+/*
+ * Snapshots. zf_snapshot() copies the live state of the interpreter to the
+ * host buffer: the context with the user variables, the used part of the
+ * stacks and the PAD heap. The dictionary, the PAD strings, the data space
+ * and the block buffers stay shared: the first store to them saves the old
+ * bytes in an undo log, in the rest of the buffer. zf_restore() undoes the
+ * stores and copies the state back, dropping whatever ran in between, so the
+ * cost of both is in the size of the stacks and heap and in the stores made.
+ * Words needing block I/O abort while a snapshot is active.
+ */
+
+typedef struct
+{
+    struct zf_ctx ctx;
+    zf_addr uservar[USERVAR_COUNT];
+    zf_addr dstack_len, rstack_len, heap_len;
+} snap_header;
+
+/* An undo log entry, which follows the bytes it saved */
+
+typedef struct
+{
+    zf_addr addr;
+    zf_addr len;
+} snap_entry;
+
+static void snap_keep(zf_addr addr, size_t len)
+{
+    snap_entry e = {addr, len};
+    size_t end = (size_t)addr + len;
+
+    if (len == 0 ||
+        !(addr < ctx->snap_here || (addr < ctx->snap_pad && end > ZF_PAD) ||
+          (addr < ctx->snap_data && end > ZF_DATA) || end > ZF_BLOCKS))
+        return;
+
+    /* Stores to the same variable in a loop are logged once */
+    if (ctx->snap_used > ctx->snap_log)
+    {
+        snap_entry last;
+        memcpy(&last, ctx->snap + ctx->snap_used - sizeof(last), sizeof(last));
+        if (last.addr == addr && last.len >= len)
+            return;
+    }
+
+    if (len + sizeof(e) > ctx->snap_size - ctx->snap_used)
+        zf_abort(ZF_ABORT_OUTSIDE_MEM);
+    memcpy(ctx->snap + ctx->snap_used, &ctx->mem[addr], len);
+    ctx->snap_used += len;
+    memcpy(ctx->snap + ctx->snap_used, &e, sizeof(e));
+    ctx->snap_used += sizeof(e);
+}
+
+/* Snapshot the interpreter into 'buf', which must be cell aligned. Returns
+ * the size of the copied state, or 0 if 'buf' is too small or the
+ * interpreter is not idle. The snapshot stays active until zf_restore() */
+
+size_t zf_snapshot(void *buf, size_t len)
+{
+    snap_header *h = buf;
+    uint8_t *p = (uint8_t *)(h + 1);
+    zf_addr bottom = heap()->bottom;
+
+    if (ctx->snap || ctx->eval_depth > 0 || ctx->suspended || ctx->task != 0)
+        return 0;
+
+    zf_addr dstack_len = DSTACK - ZF_DSTACK;
+    zf_addr rstack_len = ZF_RSTACK - RSTACK;
+    zf_addr heap_len = HEAP_TOP - bottom;
+    size_t used = sizeof(*h) + dstack_len + rstack_len + heap_len;
+
+    if (len < used)
+        return 0;
+
+    memcpy(&h->ctx, ctx, sizeof(*ctx));
+    memcpy(h->uservar, ctx->uservar, sizeof(h->uservar));
+    h->dstack_len = dstack_len;
+    h->rstack_len = rstack_len;
+    h->heap_len = heap_len;
+    memcpy(p, &ctx->mem[ZF_DSTACK], dstack_len);
+    p += dstack_len;
+    memcpy(p, &ctx->mem[RSTACK + sizeof(zf_cell)], rstack_len);
+    p += rstack_len;
+    memcpy(p, &ctx->mem[bottom], heap_len);
+
+    ctx->snap = buf;
+    ctx->snap_log = used;
+    ctx->snap_used = used;
+    ctx->snap_size = len;
+    ctx->snap_here = HERE;
+    ctx->snap_pad = PAD;
+    ctx->snap_data = ctx->data_here;
+    return used;
+}
+
+/* Back to the state of the active snapshot in 'buf'. A suspended evaluation
+ * is dropped */
+
+void zf_restore(const void *buf)
+{
+    const snap_header *h = buf;
+    const uint8_t *p = (const uint8_t *)(h + 1);
+    size_t used = ctx->snap_used;
+
+    if (ctx->snap != buf)
+        return;
+
+    /* Undo the stores, latest first */
+    while (used > ctx->snap_log)
+    {
+        snap_entry e;
+        used -= sizeof(e);
+        memcpy(&e, ctx->snap + used, sizeof(e));
+        used -= e.len;
+        memcpy(&ctx->mem[e.addr], ctx->snap + used, e.len);
     }
+
+    memcpy(ctx, &h->ctx, sizeof(*ctx));
+    memcpy(ctx->uservar, h->uservar, sizeof(h->uservar));
+    memcpy(&ctx->mem[ZF_DSTACK], p, h->dstack_len);
+    p += h->dstack_len;
+    memcpy(&ctx->mem[RSTACK + sizeof(zf_cell)], p, h->rstack_len);
+    p += h->rstack_len;
+    memcpy(&ctx->mem[HEAP_TOP - h->heap_len], p, h->heap_len);
 }
 
 void *zf_dump(size_t *len)
 {
     if (len)
-        *len = sizeof(mem);
-    return mem;
+        *len = ZF_MEMORY_SIZE;
+    return ctx->mem;
+}
+
+size_t zf_get_free_mem()
+{
+    return DICT_SIZE - HERE;
 }
 
 /*
- * Free mem
+ * Dictionary images. An image is a header followed by the used parts of the
+ * memory: the dictionary from address 0 to HERE (user variables included),
+ * the live part of the PAD, the PAD heap and, optionally, the data and return
+ * stacks.
+ *
+ * The header records the format version, the cell type, the region sizes of
+ * the interpreter which saved it and a checksum of the primitive and user
+ * variable tables, so that an image built by another version of zforth is
+ * rejected instead of running bad opcodes. A CRC covers the header and all
+ * the sections. The sections only have to fit in the regions of the loading
+ * interpreter, but PAD addresses depend on the dictionary size, and heap
+ * addresses on the PAD size too, so an image holding PAD data needs the same
+ * sizes.
  */
 
-size_t zf_get_free_mem()
+#define ZF_IMAGE_MAGIC 0x0049465a /* "ZFI" */
+#define ZF_IMAGE_VERSION 7
+#define ZF_IMAGE_ENCODING 1       /* variable length cells, see dict_put_cell_typed() */
+#define ZF_IMAGE_BIG_ENDIAN 0x100 /* flags which are not selected by the caller */
+#define ZF_IMAGE_NO_PAD 0x200     /* leave the PAD and the heap out, see zf_export() */
+
+typedef struct
 {
-    return (ZF_DICT_SIZE - HERE) + (ZF_DSTACK - PAD) + (RSTACK - DSTACK);
+    uint32_t magic;
+    uint16_t version;
+    uint16_t flags;
+    uint8_t cell_size;
+    uint8_t cell_float; /* 1 if zf_cell is a floating point type */
+    uint8_t addr_size;
+    uint8_t encoding;
+    uint32_t abi; /* crc of primitive and user variable names */
+    uint32_t dict_size;
+    uint32_t pad_size;
+    uint32_t stack_size;
+    uint32_t dict_len;
+    uint32_t pad_len;
+    uint32_t dstack_len;
+    uint32_t rstack_len;
+    uint32_t heap_len;
+    uint32_t reserved; /* 0 */
+    uint32_t crc;
+} zf_image_header; /* 56 bytes, a multiple of the cell size */
+
+static uint32_t crc32(uint32_t crc, const void *buf, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)buf;
+
+    crc = ~crc;
+    while (len--)
+    {
+        crc ^= *p++;
+        for (int k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+    }
+    return ~crc;
+}
+
+static void image_header(zf_image_header *h, int flags)
+{
+    const uint16_t one = 1;
+    uint32_t abi = 0;
+
+    for (int i = 0; i < prim_count; i++)
+        abi = crc32(abi, prim_names[i], strlen(prim_names[i]) + 1);
+    abi = crc32(abi, uservar_names, sizeof(uservar_names));
+
+    memset(h, 0, sizeof(*h));
+    h->magic = ZF_IMAGE_MAGIC;
+    h->version = ZF_IMAGE_VERSION;
+    h->flags = (flags & ZF_IMAGE_STACKS) | (*(const uint8_t *)&one ? 0 : ZF_IMAGE_BIG_ENDIAN);
+    h->cell_size = sizeof(zf_cell);
+    h->cell_float = (zf_cell)0.5 != 0;
+    h->addr_size = sizeof(zf_addr);
+    h->encoding = ZF_IMAGE_ENCODING;
+    h->abi = abi;
+    h->dict_size = DICT_SIZE;
+    h->pad_size = PAD_SIZE;
+    h->stack_size = STACK_SIZE;
+}
+
+size_t zf_image_save(zf_image_writer write, void *arg, int flags)
+{
+    zf_image_header h;
+    size_t total = sizeof(h);
+
+    image_header(&h, flags);
+    h.dict_len = HERE;
+    if (!(flags & ZF_IMAGE_NO_PAD))
+    {
+        h.pad_len = PAD - ZF_PAD;
+        if (heap()->bottom < HEAP_META)
+            h.heap_len = HEAP_TOP - heap()->bottom;
+    }
+    if (flags & ZF_IMAGE_STACKS)
+    {
+        h.dstack_len = DSTACK - ZF_DSTACK;
+        h.rstack_len = ZF_RSTACK - RSTACK;
+    }
+
+    const uint8_t *sections[] = {&ctx->mem[0], &ctx->mem[ZF_PAD], &ctx->mem[HEAP_TOP - h.heap_len], &ctx->mem[ZF_DSTACK],
+                                 &ctx->mem[RSTACK + sizeof(zf_cell)]};
+    const uint32_t lens[] = {h.dict_len, h.pad_len, h.heap_len, h.dstack_len, h.rstack_len};
+
+    h.crc = crc32(0, &h, sizeof(h));
+    for (int i = 0; i < 5; i++)
+        h.crc = crc32(h.crc, sections[i], lens[i]);
+
+    if (write(arg, &h, sizeof(h)) != sizeof(h))
+        return 0;
+    for (int i = 0; i < 5; i++)
+    {
+        if (write(arg, sections[i], lens[i]) != lens[i])
+            return 0;
+        total += lens[i];
+    }
+    return total;
+}
+
+static bool image_check(const zf_image_header *h)
+{
+    zf_image_header ours;
+
+    image_header(&ours, h->flags);
+    return h->magic == ours.magic && h->version == ours.version && h->flags == ours.flags &&
+           h->cell_size == ours.cell_size && h->cell_float == ours.cell_float &&
+           h->addr_size == ours.addr_size && h->encoding == ours.encoding &&
+           h->abi == ours.abi && h->reserved == 0 &&
+           (h->pad_len == 0 || h->dict_size == ours.dict_size) &&
+           (h->heap_len == 0 || (h->dict_size == ours.dict_size && h->pad_size == ours.pad_size)) &&
+           h->dict_len >= LIT_POOL_END && h->dict_len <= DICT_SIZE &&
+           (uint64_t)h->pad_len + h->heap_len <= HEAP_TOP - ZF_PAD &&
+           (h->heap_len == 0 || h->heap_len >= sizeof(heap_meta)) &&
+           h->dstack_len + h->rstack_len <= STACK_SIZE - sizeof(zf_cell);
+}
+
+/*
+ * HERE and LATEST come from the image, the other user variables are set from
+ * the sections which were loaded
+ */
+
+static void image_start(const zf_image_header *h, zf_addr trace)
+{
+    TRACE = trace;
+    COMPILING = 0;
+    POSTPONE = 0;
+    ctx->txn_open = false;
+    block_reset();
+    task_reset();
+    PAD = ZF_PAD + h->pad_len;
+    DSTACK = ZF_DSTACK + h->dstack_len;
+    RSTACK = ZF_RSTACK - h->rstack_len;
+    if (h->heap_len == 0)
+        heap_init();
+    ctx->input_state = ZF_INPUT_INTERPRET;
+    ctx->ip = 0;
+}
+
+/*
+ * Load an image. The sections are read to a buffer and only copied to the
+ * interpreter memory once the whole image has been checked, so on an error
+ * the current dictionary is left as it was. A word calling this from a
+ * syscall does not resume, as its code may have moved.
+ */
+
+zf_result zf_image_load(zf_image_reader read, void *arg)
+{
+    zf_image_header h;
+    uint32_t crc;
+    uint8_t *buf;
+
+    if (read(arg, &h, sizeof(h)) != sizeof(h) || !image_check(&h))
+        return ZF_ABORT_INVALID_SIZE;
+
+    const uint32_t lens[] = {h.dict_len, h.pad_len, h.heap_len, h.dstack_len, h.rstack_len};
+    size_t total = (size_t)h.dict_len + h.pad_len + h.heap_len + h.dstack_len + h.rstack_len;
+
+    buf = malloc(total ? total : 1);
+    if (!buf)
+        return ZF_ABORT_OUTSIDE_MEM;
+
+    crc = h.crc;
+    h.crc = 0;
+    if (read(arg, buf, total) != total || crc32(crc32(0, &h, sizeof(h)), buf, total) != crc)
+    {
+        free(buf);
+        return ZF_ABORT_INVALID_SIZE;
+    }
+
+    zf_addr rstack = ZF_RSTACK - h.rstack_len;
+    uint8_t *sections[] = {&ctx->mem[0], &ctx->mem[ZF_PAD], &ctx->mem[HEAP_TOP - h.heap_len], &ctx->mem[ZF_DSTACK],
+                           &ctx->mem[rstack + sizeof(zf_cell)]};
+    const uint8_t *p = buf;
+
+    for (int i = 0; i < 5; i++)
+    {
+        memcpy(sections[i], p, lens[i]);
+        p += lens[i];
+    }
+    free(buf);
+
+    image_start(&h, TRACE);
+    return ZF_OK;
+}
+
+/*
+ * Run directly on an image file mapped in memory by the host. The interpreter
+ * memory starts right after the header (whose size keeps cells aligned), so
+ * 'image' must be followed by sizeof(header) + zf_dump() size bytes of
+ * writable memory. With a private copy-on-write mapping, pages of the
+ * dictionary which are never written stay shared between processes.
+ */
+
+zf_result zf_image_map(void *image, size_t len)
+{
+    zf_image_header h;
+    uint8_t *m = (uint8_t *)image + sizeof(h);
+    uint32_t crc;
+
+    if (len < sizeof(h))
+        return ZF_ABORT_INVALID_SIZE;
+    memcpy(&h, image, sizeof(h));
+    size_t total = (size_t)h.dict_len + h.pad_len + h.heap_len + h.dstack_len + h.rstack_len;
+    if (!image_check(&h) || len < sizeof(h) + total)
+        return ZF_ABORT_INVALID_SIZE;
+
+    crc = h.crc;
+    h.crc = 0;
+    if (crc32(crc32(0, &h, sizeof(h)), m, total) != crc)
+        return ZF_ABORT_INVALID_SIZE;
+
+    zf_addr trace = TRACE;
+    mem_free();
+    ctx->mem = m;
+    ctx->mem_mapped = true;
+    ctx->uservar = (zf_addr *)ctx->mem;
+
+    /* The PAD, heap and stack sections follow the dictionary in the file,
+     * move them to their place, last one first */
+
+    zf_addr at = h.dict_len + h.pad_len + h.heap_len + h.dstack_len;
+    memmove(&ctx->mem[ZF_RSTACK - h.rstack_len + sizeof(zf_cell)], &ctx->mem[at], h.rstack_len);
+    at -= h.dstack_len;
+    memmove(&ctx->mem[ZF_DSTACK], &ctx->mem[at], h.dstack_len);
+    at -= h.heap_len;
+    memmove(&ctx->mem[HEAP_TOP - h.heap_len], &ctx->mem[at], h.heap_len);
+    at -= h.pad_len;
+    memmove(&ctx->mem[ZF_PAD], &ctx->mem[at], h.pad_len);
+
+    image_start(&h, trace);
+    return ZF_OK;
+}
+
+/*
+ * Save an image holding only the words reachable from 'entry', the
+ * primitives and the user variables, for deploying a finished program. The
+ * dictionary is shaken in place and restored afterwards.
+ */
+
+size_t zf_export(const char *entry, int flags, zf_image_writer write, void *arg)
+{
+    zf_addr w, code, here = HERE;
+    size_t len = 0;
+    uint8_t *backup;
+
+    if (!find_word(entry, &w, &code))
+        return 0;
+    backup = malloc(here);
+    if (!backup)
+        return 0;
+
+    memcpy(backup, ctx->mem, here);
+    if (compact_words(w, flags & ZF_EXPORT_STRIP))
+        len = zf_image_save(write, arg, ZF_IMAGE_NO_PAD);
+    memcpy(ctx->mem, backup, here);
+    free(backup);
+    return len;
 }
 
 /* 
@@ -1490,7 +4330,7 @@ int zf_words_count(const char *prefix)
         zf_addr p = word;
         p += dict_get_cell(word, &d);
         p += dict_get_cell(p, &link);
-        if ((prefix && strlen(prefix) > 0 && strncmp(prefix, (const char *)&mem[p], strlen(prefix)) != 0) || ((int)d & ZF_FLAG_HIDDEN))
+        if ((prefix && strlen(prefix) > 0 && strncmp(prefix, (const char *)&ctx->mem[p], strlen(prefix)) != 0) || ((int)d & ZF_FLAG_HIDDEN))
             count--;
         word = link;
     }
@@ -1509,7 +4349,7 @@ int zf_words_list(const char *words[], int size, bool sorted, const char *prefix
         p += dict_get_cell(p, &link);
         if (prefix && strlen(prefix) > 0)
         {
-            if (strncmp(prefix, (const char *)&mem[p], strlen(prefix)) != 0)
+            if (strncmp(prefix, (const char *)&ctx->mem[p], strlen(prefix)) != 0)
             {
                 count--;
                 word = link;
@@ -1519,7 +4359,7 @@ int zf_words_list(const char *words[], int size, bool sorted, const char *prefix
         if ((int)d & ZF_FLAG_HIDDEN)
             count--;
         else
-            _words[count] = (const char *)&mem[p];
+            _words[count] = (const char *)&ctx->mem[p];
         word = link;
     }
 
@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <stdarg.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 /* Abort reasons */
 
@@ -23,6 +24,10 @@ typedef enum
   ZF_ABORT_INVALID_SIZE,
   ZF_ABORT_DIVISION_BY_ZERO,
   ZF_ABORT_INTERRUPT,
+  ZF_ABORT_OUTSIDE_PAD,
+  ZF_ABORT_BLOCK_IO,
+  ZF_ABORT_THROW, /* 'throw' not caught, see zf_throw_code() */
+  ZF_RUNNING, /* not an abort: a sliced evaluation is not done yet */
 } zf_result;
 
 typedef enum
@@ -53,13 +58,37 @@ typedef enum
   ZF_SYSCALL_USER = 128
 } zf_syscall_id;
 
+/* Dictionary images: flags and stream callbacks, which return the number of
+ * bytes written or read */
+
+#define ZF_IMAGE_STACKS 0x01 /* also save the data and return stacks */
+#define ZF_EXPORT_STRIP 0x01 /* drop the names of exported words, except the entry word */
+
+/* An interpreter context, see zf_ctx_new() */
+
+typedef struct zf_ctx zf_ctx;
+
+typedef size_t (*zf_image_writer)(void *arg, const void *buf, size_t len);
+typedef size_t (*zf_image_reader)(void *arg, void *buf, size_t len);
+
 /* ZForth API functions */
 
-void zf_init(int trace);
+zf_result zf_init(int trace, zf_addr dict_size, zf_addr pad_size, zf_addr stack_size, zf_addr data_size);
 void zf_bootstrap(void);
 void *zf_dump(size_t *len);
+size_t zf_image_save(zf_image_writer write, void *arg, int flags);
+zf_result zf_image_load(zf_image_reader read, void *arg);
+zf_result zf_image_map(void *image, size_t len);
+size_t zf_export(const char *entry, int flags, zf_image_writer write, void *arg);
 zf_result zf_eval(const char *buf);
+zf_result zf_eval_slice(const char *buf, uint32_t budget);
+zf_result zf_run_slice(uint32_t budget);
+zf_result zf_run_cancel(void);
+zf_result zf_call(zf_addr xt);
+size_t zf_snapshot(void *buf, size_t len);
+void zf_restore(const void *buf);
 void zf_abort(zf_result reason);
+zf_cell zf_throw_code(void);
 
 void zf_push(zf_cell v);
 zf_cell zf_pop(void);
@@ -69,11 +98,33 @@ size_t zf_get_free_mem();
 int zf_words_count(const char *prefix);
 int zf_words_list(const char *words[], int size, bool sorted, const char *prefix);
 
+/* Contexts. Each context is a complete interpreter with its own memory. The
+ * functions above work on the context selected by the calling thread, which
+ * is a built-in one set up by zf_init() unless another is selected */
+
+zf_ctx *zf_ctx_new(int trace, zf_addr dict_size, zf_addr pad_size, zf_addr stack_size, zf_addr data_size);
+void zf_ctx_free(zf_ctx *ctx);
+zf_result zf_ctx_share(zf_ctx *ctx);
+zf_ctx *zf_ctx_spawn(zf_ctx *core);
+zf_ctx *zf_ctx_select(zf_ctx *ctx);
+zf_ctx *zf_ctx_current(void);
+zf_result zf_ctx_eval(zf_ctx *ctx, const char *buf);
+void zf_ctx_push(zf_ctx *ctx, zf_cell v);
+zf_cell zf_ctx_pop(zf_ctx *ctx);
+
 /* Host provides these functions */
 
-zf_input_state zf_host_sys(zf_syscall_id id, const char *last_word);
+zf_input_state zf_host_sys(zf_ctx *ctx, zf_syscall_id id, const char *last_word);
 void zf_host_trace(const char *fmt, va_list va);
 void zf_host_print(const char *fmt, ...);
-zf_cell zf_host_parse_num(const char *buf);
+zf_cell zf_host_parse_num(zf_ctx *ctx, const char *buf);
+
+/* Block storage: read or write block 'blk' of ZF_BLOCK_SIZE bytes, returning
+ * false on error. A block never written reads as zeros. zf_host_block_done()
+ * ends a batch of transfers, so the host can close its file */
+
+bool zf_host_block_read(unsigned int blk, void *buf);
+bool zf_host_block_write(unsigned int blk, const void *buf);
+void zf_host_block_done(void);
 
 #endif
@@ -0,0 +1,324 @@
+unsigned char all_zfi[] = {
+  0x5a, 0x46, 0x49, 0x00, 0x07, 0x00, 0x00, 0x00, 0x08, 0x01, 0x04, 0x01,
+  0xe2, 0x4b, 0x06, 0x0d, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x10, 0x00,
+  0x00, 0x00, 0x10, 0x00, 0xcc, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x29, 0xf3, 0xcb, 0xd8, 0xcc, 0x0e, 0x00, 0x00,
+  0xbe, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x04, 0xf8, 0xff, 0x1f, 0x04,
+  0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xbf, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xd0, 0x40, 0x18, 0x2d, 0x44, 0x54, 0xfb, 0x21, 0x09, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x65, 0x78, 0x69, 0x74, 0x00, 0x00,
+  0x00, 0x20, 0x81, 0x28, 0x61, 0x62, 0x6f, 0x72, 0x74, 0x00, 0x01, 0x00,
+  0x20, 0x81, 0x31, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x02, 0x00,
+  0x20, 0x81, 0x3c, 0x66, 0x6f, 0x72, 0x67, 0x65, 0x74, 0x00, 0x03, 0x00,
+  0x20, 0x81, 0x48, 0x6c, 0x69, 0x74, 0x00, 0x04, 0x00, 0x20, 0x81, 0x54,
+  0x6c, 0x69, 0x74, 0x73, 0x00, 0x05, 0x00, 0x20, 0x81, 0x5d, 0x3c, 0x30,
+  0x00, 0x06, 0x00, 0x20, 0x81, 0x67, 0x3a, 0x00, 0x07, 0x00, 0x60, 0x81,
+  0x6f, 0x3b, 0x00, 0x08, 0x00, 0x20, 0x81, 0x76, 0x2b, 0x00, 0x09, 0x00,
+  0x20, 0x81, 0x7d, 0x2d, 0x00, 0x0a, 0x00, 0x20, 0x81, 0x84, 0x2a, 0x00,
+  0x0b, 0x00, 0x20, 0x81, 0x8b, 0x2f, 0x00, 0x0c, 0x00, 0x20, 0x81, 0x92,
+  0x6d, 0x6f, 0x64, 0x00, 0x0d, 0x00, 0x20, 0x81, 0x99, 0x64, 0x72, 0x6f,
+  0x70, 0x00, 0x0e, 0x00, 0x20, 0x81, 0xa2, 0x64, 0x75, 0x70, 0x00, 0x0f,
+  0x00, 0x20, 0x81, 0xac, 0x32, 0x64, 0x75, 0x70, 0x00, 0x10, 0x00, 0x20,
+  0x81, 0xb5, 0x70, 0x69, 0x63, 0x6b, 0x72, 0x00, 0x11, 0x00, 0x60, 0x81,
+  0xbf, 0x69, 0x6d, 0x6d, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x00, 0x12,
+  0x00, 0x60, 0x81, 0xca, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6e, 0x00, 0x13,
+  0x00, 0x30, 0x81, 0xd9, 0x40, 0x40, 0x00, 0x14, 0x00, 0x30, 0x81, 0xe5,
+  0x21, 0x21, 0x00, 0x15, 0x00, 0x20, 0x81, 0xed, 0x73, 0x77, 0x61, 0x70,
+  0x00, 0x16, 0x00, 0x20, 0x81, 0xf5, 0x32, 0x73, 0x77, 0x61, 0x70, 0x00,
+  0x17, 0x00, 0x20, 0x81, 0xff, 0x32, 0x6f, 0x76, 0x65, 0x72, 0x00, 0x18,
+  0x00, 0x20, 0x82, 0x0a, 0x74, 0x75, 0x63, 0x6b, 0x00, 0x19, 0x00, 0x20,
+  0x82, 0x15, 0x32, 0x74, 0x75, 0x63, 0x6b, 0x00, 0x1a, 0x00, 0x20, 0x82,
+  0x1f, 0x72, 0x6f, 0x74, 0x00, 0x1b, 0x00, 0x20, 0x82, 0x2a, 0x6a, 0x6d,
+  0x70, 0x00, 0x1c, 0x00, 0x20, 0x82, 0x33, 0x6a, 0x6d, 0x70, 0x30, 0x00,
+  0x1d, 0x00, 0x20, 0x82, 0x3c, 0x27, 0x00, 0x1e, 0x00, 0x20, 0x82, 0x46,
+  0x5b, 0x27, 0x5d, 0x00, 0x1f, 0x00, 0x70, 0x82, 0x4d, 0x28, 0x00, 0x20,
+  0x00, 0x70, 0x82, 0x56, 0x5c, 0x00, 0x21, 0x00, 0x20, 0x82, 0x5d, 0x3e,
+  0x72, 0x00, 0x22, 0x00, 0x20, 0x82, 0x64, 0x72, 0x3e, 0x00, 0x23, 0x00,
+  0x20, 0x82, 0x6c, 0x3d, 0x00, 0x24, 0x00, 0x20, 0x82, 0x74, 0x73, 0x79,
+  0x73, 0x00, 0x25, 0x00, 0x20, 0x82, 0x7b, 0x70, 0x69, 0x63, 0x6b, 0x00,
+  0x26, 0x00, 0x30, 0x82, 0x84, 0x2c, 0x2c, 0x00, 0x27, 0x00, 0x20, 0x82,
+  0x8e, 0x77, 0x6f, 0x72, 0x64, 0x00, 0x28, 0x00, 0x30, 0x82, 0x96, 0x23,
+  0x23, 0x00, 0x29, 0x00, 0x20, 0x82, 0xa0, 0x26, 0x00, 0x2a, 0x00, 0x60,
+  0x82, 0xa8, 0x73, 0x22, 0x00, 0x2b, 0x00, 0x20, 0x82, 0xaf, 0x65, 0x78,
+  0x65, 0x63, 0x75, 0x74, 0x65, 0x00, 0x2c, 0x00, 0x20, 0x82, 0xb7, 0x63,
+  0x6d, 0x6f, 0x76, 0x65, 0x00, 0x2d, 0x00, 0x20, 0x82, 0xc4, 0x63, 0x68,
+  0x61, 0x72, 0x00, 0x2e, 0x00, 0x20, 0x82, 0xcf, 0x77, 0x6f, 0x72, 0x64,
+  0x73, 0x00, 0x2f, 0x00, 0x20, 0x82, 0xd9, 0x73, 0x65, 0x65, 0x00, 0x30,
+  0x00, 0x20, 0x82, 0xe4, 0x63, 0x65, 0x6c, 0x6c, 0x73, 0x00, 0x31, 0x00,
+  0x20, 0x82, 0xed, 0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x00, 0x32, 0x00, 0x20,
+  0x82, 0xf8, 0x63, 0x6f, 0x6d, 0x70, 0x61, 0x72, 0x65, 0x00, 0x33, 0x00,
+  0x20, 0x83, 0x03, 0x73, 0x65, 0x61, 0x72, 0x63, 0x68, 0x00, 0x34, 0x00,
+  0x20, 0x83, 0x10, 0x61, 0x74, 0x6f, 0x69, 0x00, 0x35, 0x00, 0x20, 0x83,
+  0x1c, 0x61, 0x74, 0x6f, 0x66, 0x00, 0x36, 0x00, 0x20, 0x83, 0x26, 0x63,
+  0x6f, 0x6d, 0x70, 0x61, 0x63, 0x74, 0x00, 0x37, 0x00, 0x20, 0x83, 0x30,
+  0x61, 0x6c, 0x6c, 0x6f, 0x63, 0x61, 0x74, 0x65, 0x00, 0x38, 0x00, 0x20,
+  0x83, 0x3d, 0x66, 0x72, 0x65, 0x65, 0x00, 0x39, 0x00, 0x20, 0x83, 0x4b,
+  0x72, 0x65, 0x73, 0x69, 0x7a, 0x65, 0x00, 0x3a, 0x00, 0x20, 0x83, 0x55,
+  0x78, 0x61, 0x6c, 0x6c, 0x6f, 0x74, 0x00, 0x3b, 0x00, 0x20, 0x83, 0x61,
+  0x78, 0x68, 0x65, 0x72, 0x65, 0x00, 0x3c, 0x00, 0x20, 0x83, 0x6d, 0x78,
+  0x72, 0x65, 0x6c, 0x65, 0x61, 0x73, 0x65, 0x00, 0x3d, 0x00, 0x20, 0x83,
+  0x78, 0x40, 0x00, 0x3e, 0x00, 0x20, 0x83, 0x86, 0x21, 0x00, 0x3f, 0x00,
+  0x20, 0x83, 0x8d, 0x2c, 0x00, 0x40, 0x00, 0x20, 0x83, 0x94, 0x40, 0x76,
+  0x00, 0x41, 0x00, 0x20, 0x83, 0x9b, 0x21, 0x76, 0x00, 0x42, 0x00, 0x20,
+  0x83, 0xa3, 0x2c, 0x76, 0x00, 0x43, 0x00, 0x20, 0x83, 0xab, 0x40, 0x75,
+  0x38, 0x00, 0x44, 0x00, 0x20, 0x83, 0xb3, 0x40, 0x73, 0x38, 0x00, 0x45,
+  0x00, 0x20, 0x83, 0xbc, 0x40, 0x75, 0x31, 0x36, 0x00, 0x46, 0x00, 0x20,
+  0x83, 0xc5, 0x40, 0x73, 0x31, 0x36, 0x00, 0x47, 0x00, 0x20, 0x83, 0xcf,
+  0x40, 0x75, 0x33, 0x32, 0x00, 0x48, 0x00, 0x20, 0x83, 0xd9, 0x40, 0x73,
+  0x33, 0x32, 0x00, 0x49, 0x00, 0x20, 0x83, 0xe3, 0x21, 0x38, 0x00, 0x4a,
+  0x00, 0x20, 0x83, 0xed, 0x21, 0x31, 0x36, 0x00, 0x4b, 0x00, 0x20, 0x83,
+  0xf5, 0x21, 0x33, 0x32, 0x00, 0x4c, 0x00, 0x20, 0x83, 0xfe, 0x28, 0x61,
+  0x64, 0x64, 0x72, 0x29, 0x00, 0x4d, 0x00, 0x20, 0x84, 0x07, 0x28, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x29, 0x00, 0x4e, 0x00, 0x20, 0x84, 0x13, 0x28,
+  0x74, 0x6f, 0x29, 0x00, 0x4f, 0x00, 0x20, 0x84, 0x20, 0x28, 0x64, 0x6f,
+  0x65, 0x73, 0x29, 0x00, 0x50, 0x00, 0x20, 0x84, 0x2a, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x61, 0x6e, 0x74, 0x00, 0x51, 0x00, 0x20, 0x84, 0x36, 0x76,
+  0x61, 0x6c, 0x75, 0x65, 0x00, 0x52, 0x00, 0x60, 0x84, 0x44, 0x74, 0x6f,
+  0x00, 0x53, 0x00, 0x60, 0x84, 0x4f, 0x64, 0x6f, 0x65, 0x73, 0x3e, 0x00,
+  0x54, 0x00, 0x20, 0x84, 0x57, 0x66, 0x69, 0x6c, 0x6c, 0x00, 0x55, 0x00,
+  0x20, 0x84, 0x62, 0x63, 0x65, 0x6c, 0x6c, 0x2d, 0x66, 0x69, 0x6c, 0x6c,
+  0x00, 0x56, 0x00, 0x20, 0x84, 0x6c, 0x62, 0x6c, 0x6f, 0x63, 0x6b, 0x00,
+  0x57, 0x00, 0x20, 0x84, 0x7b, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x00,
+  0x58, 0x00, 0x20, 0x84, 0x86, 0x75, 0x70, 0x64, 0x61, 0x74, 0x65, 0x00,
+  0x59, 0x00, 0x20, 0x84, 0x92, 0x73, 0x61, 0x76, 0x65, 0x2d, 0x62, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x73, 0x00, 0x5a, 0x00, 0x20, 0x84, 0x9e, 0x65,
+  0x6d, 0x70, 0x74, 0x79, 0x2d, 0x62, 0x75, 0x66, 0x66, 0x65, 0x72, 0x73,
+  0x00, 0x5b, 0x00, 0x20, 0x84, 0xb0, 0x66, 0x6c, 0x75, 0x73, 0x68, 0x00,
+  0x5c, 0x00, 0x20, 0x84, 0xc3, 0x74, 0x61, 0x73, 0x6b, 0x00, 0x5d, 0x00,
+  0x20, 0x84, 0xce, 0x61, 0x63, 0x74, 0x69, 0x76, 0x61, 0x74, 0x65, 0x00,
+  0x5e, 0x00, 0x20, 0x84, 0xd8, 0x70, 0x61, 0x75, 0x73, 0x65, 0x00, 0x5f,
+  0x00, 0x20, 0x84, 0xe6, 0x73, 0x74, 0x6f, 0x70, 0x00, 0x60, 0x00, 0x20,
+  0x84, 0xf1, 0x63, 0x61, 0x74, 0x63, 0x68, 0x00, 0x61, 0x00, 0x20, 0x84,
+  0xfb, 0x74, 0x68, 0x72, 0x6f, 0x77, 0x00, 0x62, 0x00, 0x20, 0x85, 0x06,
+  0x40, 0x63, 0x00, 0x3e, 0x00, 0x20, 0x85, 0x11, 0x21, 0x63, 0x00, 0x3f,
+  0x00, 0x20, 0x85, 0x19, 0x2c, 0x63, 0x00, 0x40, 0x00, 0x00, 0x85, 0x21,
+  0x68, 0x00, 0x04, 0x00, 0x00, 0x00, 0x85, 0x29, 0x6c, 0x61, 0x74, 0x65,
+  0x73, 0x74, 0x00, 0x04, 0x01, 0x00, 0x00, 0x85, 0x31, 0x74, 0x72, 0x61,
+  0x63, 0x65, 0x00, 0x04, 0x02, 0x00, 0x00, 0x85, 0x3e, 0x63, 0x6f, 0x6d,
+  0x70, 0x69, 0x6c, 0x69, 0x6e, 0x67, 0x00, 0x04, 0x03, 0x00, 0x00, 0x85,
+  0x4a, 0x5f, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f, 0x6e, 0x65, 0x00, 0x04,
+  0x04, 0x00, 0x00, 0x85, 0x5a, 0x64, 0x73, 0x74, 0x61, 0x63, 0x6b, 0x00,
+  0x04, 0x05, 0x00, 0x00, 0x85, 0x6a, 0x72, 0x73, 0x74, 0x61, 0x63, 0x6b,
+  0x00, 0x04, 0x06, 0x00, 0x00, 0x85, 0x77, 0x70, 0x61, 0x64, 0x00, 0x04,
+  0x07, 0x00, 0x00, 0x85, 0x84, 0x65, 0x6d, 0x69, 0x74, 0x00, 0x04, 0x00,
+  0x25, 0x00, 0x00, 0x85, 0x8e, 0x2e, 0x00, 0x04, 0x01, 0x25, 0x00, 0x00,
+  0x85, 0x9a, 0x74, 0x79, 0x70, 0x65, 0x00, 0x04, 0x02, 0x25, 0x00, 0x00,
+  0x85, 0xa3, 0x69, 0x6e, 0x63, 0x6c, 0x75, 0x64, 0x65, 0x00, 0x04, 0x80,
+  0x80, 0x25, 0x00, 0x00, 0x85, 0xaf, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74,
+  0x00, 0x04, 0x80, 0x81, 0x25, 0x00, 0x00, 0x85, 0xbf, 0x2e, 0x73, 0x00,
+  0x04, 0x80, 0x82, 0x25, 0x00, 0x00, 0x85, 0xce, 0x62, 0x79, 0x65, 0x00,
+  0x04, 0x80, 0x83, 0x25, 0x00, 0x00, 0x85, 0xd9, 0x73, 0x61, 0x76, 0x65,
+  0x00, 0x04, 0x80, 0x84, 0x25, 0x00, 0x00, 0x85, 0xe5, 0x6c, 0x6f, 0x61,
+  0x64, 0x00, 0x04, 0x80, 0x85, 0x25, 0x00, 0x00, 0x85, 0xf2, 0x74, 0x69,
+  0x6d, 0x65, 0x26, 0x64, 0x61, 0x74, 0x65, 0x00, 0x04, 0x80, 0x86, 0x25,
+  0x00, 0x00, 0x85, 0xff, 0x6e, 0x6f, 0x77, 0x00, 0x04, 0x80, 0x87, 0x25,
+  0x00, 0x00, 0x86, 0x11, 0x2e, 0x64, 0x61, 0x74, 0x65, 0x00, 0x04, 0x80,
+  0x88, 0x25, 0x00, 0x00, 0x86, 0x1d, 0x2e, 0x74, 0x69, 0x6d, 0x65, 0x00,
+  0x04, 0x80, 0x89, 0x25, 0x00, 0x00, 0x86, 0x2b, 0x65, 0x78, 0x70, 0x6f,
+  0x72, 0x74, 0x00, 0x04, 0x80, 0x8a, 0x25, 0x00, 0x00, 0x86, 0x39, 0x65,
+  0x78, 0x70, 0x6f, 0x72, 0x74, 0x2d, 0x73, 0x74, 0x72, 0x69, 0x70, 0x70,
+  0x65, 0x64, 0x00, 0x04, 0x80, 0x8b, 0x25, 0x00, 0x00, 0x86, 0x48, 0x74,
+  0x69, 0x63, 0x6b, 0x73, 0x00, 0x04, 0x80, 0x99, 0x25, 0x00, 0x00, 0x86,
+  0x60, 0x6b, 0x65, 0x79, 0x3f, 0x00, 0x04, 0x80, 0x9a, 0x25, 0x00, 0x00,
+  0x86, 0x6e, 0x23, 0x00, 0x04, 0x00, 0x29, 0x00, 0x00, 0x86, 0x7b, 0x3f,
+  0x00, 0x3e, 0x85, 0x9f, 0x00, 0x40, 0x86, 0x84, 0x5b, 0x00, 0x04, 0x00,
+  0x85, 0x57, 0x3f, 0x00, 0x00, 0x86, 0x8d, 0x5d, 0x00, 0x04, 0x01, 0x85,
+  0x57, 0x3f, 0x00, 0x40, 0x86, 0x98, 0x70, 0x6f, 0x73, 0x74, 0x70, 0x6f,
+  0x6e, 0x65, 0x00, 0x04, 0x01, 0x85, 0x67, 0x3f, 0x00, 0x00, 0x86, 0xa3,
+  0x6f, 0x76, 0x65, 0x72, 0x00, 0x04, 0x01, 0x26, 0x00, 0x00, 0x86, 0xb5,
+  0x32, 0x64, 0x72, 0x6f, 0x70, 0x00, 0x0e, 0x0e, 0x00, 0x00, 0x86, 0xc1,
+  0x6e, 0x69, 0x70, 0x00, 0x16, 0x0e, 0x00, 0x00, 0x86, 0xcd, 0x32, 0x6e,
+  0x69, 0x70, 0x00, 0x17, 0x86, 0xca, 0x00, 0x00, 0x86, 0xd7, 0x2b, 0x21,
+  0x00, 0x0f, 0x3e, 0x1b, 0x09, 0x16, 0x3f, 0x00, 0x00, 0x86, 0xe3, 0x31,
+  0x2b, 0x00, 0x04, 0x01, 0x09, 0x00, 0x00, 0x86, 0xf0, 0x31, 0x2d, 0x00,
+  0x04, 0x01, 0x0a, 0x00, 0x00, 0x86, 0xfa, 0x69, 0x6e, 0x63, 0x00, 0x04,
+  0x01, 0x16, 0x86, 0xe9, 0x00, 0x00, 0x87, 0x04, 0x64, 0x65, 0x63, 0x00,
+  0x04, 0xc0, 0x16, 0x86, 0xe9, 0x00, 0x00, 0x87, 0x11, 0x3c, 0x00, 0x0a,
+  0x06, 0x00, 0x00, 0x87, 0x1e, 0x3e, 0x00, 0x16, 0x87, 0x23, 0x00, 0x00,
+  0x87, 0x26, 0x3c, 0x3d, 0x00, 0x86, 0xbd, 0x86, 0xbd, 0x22, 0x22, 0x87,
+  0x23, 0x23, 0x23, 0x24, 0x09, 0x00, 0x00, 0x87, 0x2f, 0x3e, 0x3d, 0x00,
+  0x16, 0x87, 0x35, 0x00, 0x00, 0x87, 0x42, 0x3d, 0x30, 0x00, 0x04, 0x00,
+  0x24, 0x00, 0x00, 0x87, 0x4c, 0x6e, 0x6f, 0x74, 0x00, 0x87, 0x52, 0x00,
+  0x00, 0x87, 0x56, 0x21, 0x3d, 0x00, 0x24, 0x87, 0x5d, 0x00, 0x00, 0x87,
+  0x60, 0x63, 0x72, 0x00, 0x04, 0x0a, 0x85, 0x96, 0x00, 0x00, 0x87, 0x6a,
+  0x73, 0x70, 0x00, 0x04, 0x20, 0x85, 0x96, 0x00, 0x00, 0x87, 0x75, 0x2e,
+  0x2e, 0x00, 0x0f, 0x85, 0x9f, 0x00, 0x00, 0x87, 0x80, 0x68, 0x65, 0x72,
+  0x65, 0x00, 0x85, 0x2e, 0x3e, 0x00, 0x00, 0x87, 0x8a, 0x61, 0x6c, 0x6c,
+  0x6f, 0x74, 0x00, 0x85, 0x2e, 0x86, 0xe9, 0x00, 0x00, 0x87, 0x96, 0x61,
+  0x6c, 0x69, 0x67, 0x6e, 0x65, 0x64, 0x00, 0x04, 0x01, 0x31, 0x87, 0x00,
+  0x09, 0x0f, 0x04, 0x01, 0x31, 0x0d, 0x0a, 0x00, 0x00, 0x87, 0xa4, 0x61,
+  0x6c, 0x69, 0x67, 0x6e, 0x00, 0x87, 0x92, 0x87, 0xaf, 0x85, 0x2e, 0x3f,
+  0x00, 0x00, 0x87, 0xbc, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6c, 0x65,
+  0x00, 0x02, 0x04, 0x01, 0x31, 0x87, 0x9f, 0x00, 0x00, 0x87, 0xcd, 0x65,
+  0x72, 0x61, 0x73, 0x65, 0x00, 0x04, 0x00, 0x55, 0x00, 0x00, 0x87, 0xe0,
+  0x62, 0x6c, 0x61, 0x6e, 0x6b, 0x00, 0x04, 0x20, 0x55, 0x00, 0x00, 0x87,
+  0xed, 0x6d, 0x6f, 0x76, 0x65, 0x00, 0x31, 0x2d, 0x00, 0x40, 0x87, 0xfa,
+  0x62, 0x65, 0x67, 0x69, 0x6e, 0x00, 0x87, 0x92, 0x00, 0x40, 0x88, 0x05,
+  0x61, 0x67, 0x61, 0x69, 0x6e, 0x00, 0x1f, 0x1c, 0x43, 0x43, 0x00, 0x40,
+  0x88, 0x11, 0x75, 0x6e, 0x74, 0x69, 0x6c, 0x00, 0x1f, 0x1d, 0x43, 0x43,
+  0x00, 0x40, 0x88, 0x1f, 0x74, 0x69, 0x6d, 0x65, 0x73, 0x00, 0x1f, 0x04,
+  0x01, 0x0a, 0x43, 0x1f, 0x0f, 0x43, 0x1f, 0x87, 0x52, 0x43, 0x88, 0x28,
+  0x00, 0x00, 0x88, 0x2d, 0x3e, 0x6d, 0x61, 0x72, 0x6b, 0x00, 0x87, 0x92,
+  0x04, 0xc1, 0x43, 0x00, 0x40, 0x88, 0x45, 0x69, 0x66, 0x00, 0x1f, 0x1d,
+  0x43, 0x88, 0x4e, 0x00, 0x40, 0x88, 0x54, 0x75, 0x6e, 0x6c, 0x65, 0x73,
+  0x73, 0x00, 0x1f, 0x87, 0x5d, 0x43, 0x88, 0x5a, 0x00, 0x40, 0x88, 0x60,
+  0x65, 0x6c, 0x73, 0x65, 0x00, 0x1f, 0x1c, 0x43, 0x88, 0x4e, 0x16, 0x87,
+  0x92, 0x16, 0x42, 0x00, 0x40, 0x88, 0x71, 0x66, 0x69, 0x00, 0x87, 0x92,
+  0x16, 0x42, 0x00, 0x40, 0x88, 0x84, 0x69, 0x00, 0x1f, 0x04, 0x43, 0x04,
+  0x00, 0x43, 0x1f, 0x11, 0x43, 0x00, 0x40, 0x88, 0x8f, 0x6a, 0x00, 0x1f,
+  0x04, 0x43, 0x04, 0x02, 0x43, 0x1f, 0x11, 0x43, 0x00, 0x40, 0x88, 0x9e,
+  0x64, 0x6f, 0x00, 0x1f, 0x16, 0x43, 0x1f, 0x22, 0x43, 0x1f, 0x22, 0x43,
+  0x87, 0x92, 0x00, 0x40, 0x88, 0xad, 0x6c, 0x6f, 0x6f, 0x70, 0x2b, 0x00,
+  0x1f, 0x23, 0x43, 0x1f, 0x09, 0x43, 0x1f, 0x0f, 0x43, 0x1f, 0x22, 0x43,
+  0x1f, 0x04, 0x43, 0x04, 0x01, 0x43, 0x1f, 0x11, 0x43, 0x1f, 0x87, 0x2b,
+  0x43, 0x1f, 0x1d, 0x43, 0x43, 0x1f, 0x23, 0x43, 0x1f, 0x0e, 0x43, 0x1f,
+  0x23, 0x43, 0x1f, 0x0e, 0x43, 0x00, 0x40, 0x88, 0xbf, 0x6c, 0x6f, 0x6f,
+  0x70, 0x00, 0x1f, 0x04, 0x43, 0x04, 0x01, 0x43, 0x88, 0xc8, 0x00, 0x40,
+  0x88, 0xf2, 0x5b, 0x63, 0x68, 0x61, 0x72, 0x5d, 0x00, 0x1f, 0x04, 0x43,
+  0x2e, 0x43, 0x00, 0x40, 0x89, 0x03, 0x2e, 0x22, 0x00, 0x2b, 0x85, 0x57,
+  0x3e, 0x1d, 0xfd, 0x2d, 0x09, 0x00, 0x00, 0x1f, 0x85, 0xab, 0x43, 0x1c,
+  0xfd, 0x2f, 0x09, 0x00, 0x00, 0x85, 0xab, 0x00, 0x00, 0x89, 0x13, 0x62,
+  0x6f, 0x75, 0x6e, 0x64, 0x73, 0x00, 0x86, 0xbd, 0x09, 0x00, 0x00, 0x89,
+  0x30, 0x70, 0x72, 0x6f, 0x6d, 0x70, 0x74, 0x00, 0x32, 0x85, 0xc9, 0x00,
+  0x00, 0x89, 0x3e, 0x6d, 0x61, 0x70, 0x00, 0x0f, 0x87, 0x52, 0x1d, 0xfd,
+  0x61, 0x09, 0x00, 0x00, 0x0e, 0x0e, 0x0e, 0x0e, 0x00, 0x22, 0x86, 0xbd,
+  0x3e, 0x04, 0x03, 0x26, 0x2c, 0x86, 0xbd, 0x3f, 0x16, 0x04, 0x01, 0x31,
+  0x09, 0x16, 0x04, 0x01, 0x31, 0x09, 0x23, 0x87, 0x00, 0x1c, 0x89, 0x53,
+  0x00, 0x00, 0x89, 0x4c, 0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x0f,
+  0x87, 0x52, 0x1d, 0xfd, 0x95, 0x09, 0x00, 0x00, 0x0e, 0x0e, 0x16, 0x0e,
+  0x00, 0x22, 0x0f, 0x22, 0x3e, 0x04, 0x02, 0x26, 0x2c, 0x23, 0x04, 0x01,
+  0x31, 0x09, 0x23, 0x87, 0x00, 0x1c, 0x89, 0x87, 0x00, 0x00, 0x89, 0x7d,
+  0x70, 0x6d, 0x61, 0x70, 0x00, 0x89, 0x53, 0x00, 0x00, 0x89, 0xa9, 0x70,
+  0x72, 0x65, 0x64, 0x75, 0x63, 0x65, 0x00, 0x89, 0x87, 0x00, 0x00, 0x89,
+  0xb4, 0x73, 0x6c, 0x65, 0x65, 0x70, 0x2d, 0x6d, 0x73, 0x00, 0x86, 0x69,
+  0x09, 0x5f, 0x0f, 0x86, 0x69, 0x87, 0x35, 0x1d, 0x89, 0xd1, 0x0e, 0x00,
+  0x00, 0x89, 0xc2, 0x6b, 0x65, 0x79, 0x00, 0x86, 0x76, 0x0f, 0x87, 0x5d,
+  0x1d, 0xfd, 0xef, 0x09, 0x00, 0x00, 0x5f, 0x1d, 0x89, 0xe3, 0x04, 0x03,
+  0x25, 0x00, 0x08, 0x89, 0xdc, 0x72, 0x65, 0x67, 0x73, 0x00, 0x4d, 0x8a,
+  0x08, 0x00, 0x89, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0xf6, 0x72, 0x63, 0x6c, 0x00, 0x0f,
+  0x04, 0x63, 0x87, 0x2b, 0x1d, 0xfd, 0x3b, 0x0d, 0x00, 0x00, 0x01, 0x31,
+  0x4d, 0x8a, 0x08, 0x09, 0x3e, 0x00, 0x00, 0x8d, 0x28, 0x73, 0x74, 0x6f,
+  0x00, 0x0f, 0x04, 0x63, 0x87, 0x2b, 0x1d, 0xfd, 0x55, 0x0d, 0x00, 0x00,
+  0x01, 0x31, 0x4d, 0x8a, 0x08, 0x09, 0x3f, 0x00, 0x00, 0x8d, 0x42, 0x73,
+  0x74, 0x6f, 0x2b, 0x00, 0x0f, 0x8d, 0x2f, 0x1b, 0x09, 0x16, 0x8d, 0x49,
+  0x00, 0x00, 0x8d, 0x5c, 0x73, 0x74, 0x6f, 0x2d, 0x00, 0x0f, 0x8d, 0x2f,
+  0x1b, 0x09, 0x16, 0x8d, 0x49, 0x00, 0x00, 0x8d, 0x6d, 0x73, 0x74, 0x6f,
+  0x2a, 0x00, 0x0f, 0x8d, 0x2f, 0x1b, 0x0b, 0x16, 0x8d, 0x49, 0x00, 0x00,
+  0x8d, 0x7e, 0x72, 0x63, 0x6c, 0x2b, 0x00, 0x8d, 0x2f, 0x09, 0x00, 0x00,
+  0x8d, 0x8f, 0x72, 0x63, 0x6c, 0x2d, 0x00, 0x8d, 0x2f, 0x0a, 0x00, 0x00,
+  0x8d, 0x9b, 0x72, 0x63, 0x6c, 0x2a, 0x00, 0x8d, 0x2f, 0x0b, 0x00, 0x00,
+  0x8d, 0xa7, 0x73, 0x69, 0x6e, 0x00, 0x04, 0x80, 0x8c, 0x25, 0x00, 0x00,
+  0x8d, 0xb3, 0x63, 0x6f, 0x73, 0x00, 0x04, 0x80, 0x8d, 0x25, 0x00, 0x00,
+  0x8d, 0xbf, 0x74, 0x61, 0x6e, 0x00, 0x04, 0x80, 0x8e, 0x25, 0x00, 0x00,
+  0x8d, 0xcb, 0x61, 0x73, 0x69, 0x6e, 0x00, 0x04, 0x80, 0x8f, 0x25, 0x00,
+  0x00, 0x8d, 0xd7, 0x61, 0x63, 0x6f, 0x73, 0x00, 0x04, 0x80, 0x90, 0x25,
+  0x00, 0x00, 0x8d, 0xe4, 0x61, 0x74, 0x61, 0x6e, 0x00, 0x04, 0x80, 0x91,
+  0x25, 0x00, 0x00, 0x8d, 0xf1, 0x73, 0x71, 0x72, 0x74, 0x00, 0x04, 0x80,
+  0x92, 0x25, 0x00, 0x00, 0x8d, 0xfe, 0x70, 0x6f, 0x77, 0x00, 0x04, 0x80,
+  0x93, 0x25, 0x00, 0x00, 0x8e, 0x0b, 0x6c, 0x6e, 0x00, 0x04, 0x80, 0x94,
+  0x25, 0x00, 0x00, 0x8e, 0x17, 0x6c, 0x6f, 0x67, 0x00, 0x04, 0x80, 0x95,
+  0x25, 0x00, 0x00, 0x8e, 0x22, 0x65, 0x78, 0x70, 0x00, 0x04, 0x80, 0x96,
+  0x25, 0x00, 0x00, 0x8e, 0x2e, 0x61, 0x62, 0x73, 0x00, 0x04, 0x80, 0x97,
+  0x25, 0x00, 0x00, 0x8e, 0x3a, 0x6e, 0x65, 0x67, 0x00, 0x04, 0x80, 0x98,
+  0x25, 0x00, 0x04, 0x8e, 0x46, 0x70, 0x69, 0x00, 0x04, 0xc2, 0x00, 0x00,
+  0x8e, 0x52, 0x25, 0x00, 0x04, 0x64, 0x0c, 0x0b, 0x00, 0x00, 0x8e, 0x5b,
+  0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x00, 0x04, 0x80, 0xc8, 0x25,
+  0x00, 0x00, 0x8e, 0x65, 0x63, 0x6c, 0x73, 0x00, 0x04, 0x80, 0xc9, 0x25,
+  0x00, 0x00, 0x8e, 0x75, 0x61, 0x6c, 0x65, 0x72, 0x74, 0x00, 0x04, 0x80,
+  0xca, 0x25, 0x00, 0x00, 0x8e, 0x81, 0x6d, 0x65, 0x73, 0x73, 0x61, 0x67,
+  0x65, 0x00, 0x04, 0x80, 0xcb, 0x25, 0x00, 0x00, 0x8e, 0x8f, 0x68, 0x65,
+  0x61, 0x64, 0x65, 0x72, 0x00, 0x04, 0x80, 0xcc, 0x25, 0x00, 0x00, 0x8e,
+  0x9f, 0x73, 0x65, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x00, 0x04, 0x80, 0xcd,
+  0x25, 0x00, 0x00, 0x8e, 0xae, 0x73, 0x65, 0x74, 0x78, 0x79, 0x00, 0x04,
+  0x80, 0xce, 0x25, 0x00
+};
+unsigned int all_zfi_len = 3844;